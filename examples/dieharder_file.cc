@@ -59,6 +59,8 @@
 #include "trng/mt19937.hpp"
 #include "trng/mt19937_64.hpp"
 #include "trng/count128_lcg_shift.hpp"
+#include "trng/philox4x32_10.hpp"
+#include "trng/threefry2x64_20.hpp"
 
 
 template<typename T>
@@ -124,6 +126,8 @@ int main(int argc, char *argv[]) {
   add_generator<trng::mt19937>(func_map);
   add_generator<trng::mt19937_64>(func_map);
   add_generator<trng::count128_lcg_shift>(func_map);
+  add_generator<trng::philox4x32_10>(func_map);
+  add_generator<trng::threefry2x64_20>(func_map);
 
   try {
     if (argc != 3 and argc != 4)
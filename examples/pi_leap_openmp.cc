@@ -34,23 +34,23 @@
 #include <iostream>
 #include <omp.h>
 #include <trng/yarn2.hpp>
+#include <trng/stream_factory.hpp>
 #include <trng/uniform01_dist.hpp>
 
 int main() {
-  const long samples{1000000l};  // total number of points in square
-  long in{0l};                   // no points in circle
+  const long samples{1000000l};           // total number of points in square
+  long in{0l};                            // no points in circle
+  const int size{omp_get_max_threads()};  // get total number of processes
+  // split PRN sequence by leapfrog method into 2 * size streams, the stream factory is built
+  // once and shared by all processes
+  const auto streams{trng::stream_factory<trng::yarn2>::leapfrog(trng::yarn2(), 2 * size)};
   // distribute workload over all processes and make a global reduction
-#pragma omp parallel reduction(+ : in) default(none)
+#pragma omp parallel reduction(+ : in) default(none) shared(size, streams) num_threads(size)
   {
-    trng::yarn2 rx, ry;                     // random number engines for x- and y-coordinates
-    const int size{omp_get_num_threads()};  // get total number of processes
     const int rank{omp_get_thread_num()};   // get rank of current process
-    // split PRN sequences by leapfrog method
-    rx.split(2, 0);            // choose sub-stream no. 0 out of 2 streams
-    ry.split(2, 1);            // choose sub-stream no. 1 out of 2 streams
-    rx.split(size, rank);      // choose sub-stream no. rank out of size streams
-    ry.split(size, rank);      // choose sub-stream no. rank out of size streams
-    trng::uniform01_dist<> u;  // random number distribution
+    trng::yarn2 rx{streams(2 * rank)};      // random number engine for x-coordinates
+    trng::yarn2 ry{streams(2 * rank + 1)};  // random number engine for y-coordinates
+    trng::uniform01_dist<> u;               // random number distribution
     // throw random points into square
     for (long i{rank}; i < samples; i += size) {
       const double x{u(rx)}, y{u(ry)};  // choose random x- and y-coordinates
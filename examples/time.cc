@@ -42,6 +42,8 @@
 #include <trng/lcg64_shift.hpp>
 #include <trng/lcg64_count_shift.hpp>
 #include <trng/count128_lcg_shift.hpp>
+#include <trng/philox4x32_10.hpp>
+#include <trng/threefry2x64_20.hpp>
 #include <trng/mrg2.hpp>
 #include <trng/mrg3.hpp>
 #include <trng/mrg3s.hpp>
@@ -234,6 +236,14 @@ int main() {
       trng::count128_lcg_shift r;
       time_main(r, "trng::count128_lcg_shift");
     }
+    {
+      trng::philox4x32_10 r;
+      time_main(r, "trng::philox4x32_10");
+    }
+    {
+      trng::threefry2x64_20 r;
+      time_main(r, "trng::threefry2x64_20");
+    }
     {
       trng::mrg2 r;
       time_main(r, "trng::mrg2");
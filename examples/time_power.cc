@@ -0,0 +1,149 @@
+// Copyright (c) 2000-2026, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Compares the back-ends of trng::int_math::power, which compute the modular exponentiation
+// of the yarn engines, with respect to memory footprint and throughput.  Throughput is
+// measured with a hot cache and under cache pressure, i.e., when each call is interleaved
+// with memory accesses by other code, as is typical in real applications.
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <sstream>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <trng/int_math.hpp>
+#include <trng/lcg64.hpp>
+
+template<typename T>
+std::string to_string(const T &x) {
+  std::ostringstream temp;
+  temp << x;
+  return temp.str();
+}
+
+class timer {
+private:
+  std::chrono::time_point<std::chrono::high_resolution_clock> _t;
+
+public:
+  void reset() { _t = std::chrono::high_resolution_clock::now(); }
+  double time() const {
+    const auto now = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now - _t).count() * 1e-6;
+  }
+  timer() : _t(std::chrono::high_resolution_clock::now()) {}
+};
+
+void print_column(const std::string &str, std::string::size_type width) {
+  std::string res(str);
+  while (res.length() < width)
+    res += ' ';
+  std::cout << res;
+}
+
+// modulus and generator of yarn2
+constexpr int32_t modulus{2147483647};
+constexpr int32_t gen{123567893};
+
+constexpr long calls{1l << 24};
+
+template<typename power>
+long time_hot(const power &g, std::vector<int32_t> &exponents) {
+  long s{0};
+  timer T;
+  for (long i{0}; i < calls; ++i)
+    s += g(exponents[i & (exponents.size() - 1)]);
+  print_column(to_string(1e-6 * calls / T.time()), 16);
+  return s;
+}
+
+template<typename power>
+long time_pressure(const power &g, std::vector<int32_t> &exponents,
+                   std::vector<char> &pressure) {
+  long s{0};
+  std::vector<char>::size_type j{0};
+  timer T;
+  for (long i{0}; i < calls; ++i) {
+    s += g(exponents[i & (exponents.size() - 1)]);
+    // touch four cache lines of a buffer of the size of a typical L2 cache
+    for (int k{0}; k < 4; ++k) {
+      pressure[j] += static_cast<char>(s);
+      j += 64;
+      if (j >= pressure.size())
+        j = 0;
+    }
+  }
+  print_column(to_string(1e-6 * calls / T.time()), 16);
+  return s;
+}
+
+template<typename power>
+void time_main(const std::string &name, std::vector<int32_t> &exponents,
+               std::vector<char> &pressure) {
+  std::stringstream s;  // write data to stream to prevent that code gets optimized away
+  std::unique_ptr<power> g(new power);
+  // check results against plain binary exponentiation
+  for (std::vector<int32_t>::size_type i{0}; i < 1024; ++i)
+    if ((*g)(exponents[i]) != trng::int_math::power_mod<modulus>(gen, exponents[i])) {
+      std::cerr << name << " yields wrong results\n";
+      std::exit(EXIT_FAILURE);
+    }
+  print_column(name, 24);
+  print_column(to_string(sizeof(power) / 1024.0), 16);
+  s << time_hot(*g, exponents);
+  s << time_pressure(*g, exponents, pressure);
+  std::cout << std::endl;
+}
+
+int main() {
+  // random exponents
+  trng::lcg64 R;
+  std::vector<int32_t> exponents(1u << 16u);
+  for (auto &n : exponents)
+    n = static_cast<int32_t>(R() >> 33u);
+  // buffer of 1 MB
+  std::vector<char> pressure(1u << 20u);
+  print_column("back-end", 24);
+  print_column("footprint (KB)", 16);
+  print_column("hot (1e6/s)", 16);
+  print_column("pressure (1e6/s)", 16);
+  std::cout << std::endl;
+  time_main<trng::int_math::power_table_2x16<modulus, gen>>("power_table_2x16", exponents,
+                                                             pressure);
+  time_main<trng::int_math::power_table_3x11<modulus, gen>>("power_table_3x11", exponents,
+                                                             pressure);
+  time_main<trng::int_math::power_window<modulus, gen>>("power_window", exponents, pressure);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2000-2026, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Measures the startup cost of processes that link libtrng4 and the latency of the first use
+// of each yarn engine, which builds the tables for the modular exponentiation.  The program
+// runs itself repeatedly as a minimal child process, which uses an lcg64 engine only.
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <sstream>
+#include <chrono>
+#include <trng/lcg64.hpp>
+#include <trng/yarn2.hpp>
+#include <trng/yarn3.hpp>
+#include <trng/yarn3s.hpp>
+#include <trng/yarn4.hpp>
+#include <trng/yarn5.hpp>
+#include <trng/yarn5s.hpp>
+
+template<typename T>
+std::string to_string(const T &x) {
+  std::ostringstream temp;
+  temp << x;
+  return temp.str();
+}
+
+class timer {
+private:
+  std::chrono::time_point<std::chrono::high_resolution_clock> _t;
+
+public:
+  void reset() { _t = std::chrono::high_resolution_clock::now(); }
+  double time() const {
+    const auto now = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now - _t).count() * 1e-6;
+  }
+  timer() : _t(std::chrono::high_resolution_clock::now()) {}
+};
+
+void print_column(const std::string &str, std::string::size_type width) {
+  std::string res(str);
+  while (res.length() < width)
+    res += ' ';
+  std::cout << res;
+}
+
+template<typename R>
+void time_first_use() {
+  std::stringstream s;  // write data to stream to prevent that code gets optimized away
+  R r;
+  timer T;
+  s << r();
+  const double t_first{T.time()};
+  T.reset();
+  s << r();
+  const double t_second{T.time()};
+  print_column(R::name(), 16);
+  print_column(to_string(1e3 * t_first), 20);
+  print_column(to_string(1e3 * t_second), 20);
+  std::cout << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc > 1 and std::string(argv[1]) == "child") {
+    trng::lcg64 r;
+    return r() == 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+  const std::string child{'"' + std::string(argv[0]) + "\" child"};
+  const int runs{32};
+  timer T;
+  for (int i{0}; i < runs; ++i)
+    if (std::system(child.c_str()) != 0) {
+      std::cerr << "cannot run child process\n";
+      return EXIT_FAILURE;
+    }
+  std::cout << "process startup and exit:  " << 1e3 * T.time() / runs << " ms\n\n";
+  print_column("engine", 16);
+  print_column("first call (ms)", 20);
+  print_column("second call (ms)", 20);
+  std::cout << std::endl;
+  time_first_use<trng::yarn2>();
+  time_first_use<trng::yarn3>();
+  time_first_use<trng::yarn3s>();
+  time_first_use<trng::yarn4>();
+  time_first_use<trng::yarn5>();
+  time_first_use<trng::yarn5s>();
+  return EXIT_SUCCESS;
+}
@@ -46,7 +46,13 @@
 #include <trng/uniform_dist.hpp>
 #include <trng/uniform01_dist.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/lcg64.hpp>
 #include <trng/lcg64_shift.hpp>
+#include <trng/minstd.hpp>
+#include <trng/mrg3.hpp>
+#include <trng/mt19937.hpp>
+#include <trng/mt19937_64.hpp>
+#include <trng/yarn2.hpp>
 #include <trng/exponential_dist.hpp>
 #include <trng/twosided_exponential_dist.hpp>
 #include <trng/normal_dist.hpp>
@@ -208,6 +214,48 @@ void continuous_dist_test_streamable(dist &d) {
 }
 
 
+// ranges of random numbers equal consecutive single random numbers
+template<typename dist, typename engine>
+void dist_test_generate_impl(dist &d) {
+  using result_type = typename dist::result_type;
+  for (const std::size_t n : {0, 1, 100, 1000}) {
+    engine R1(100ull), R2(100ull);
+    dist d1(d), d2(d);
+    std::vector<result_type> x(n);
+    d1.generate(R1, x.begin(), x.end());
+    for (std::size_t i{0}; i < n; ++i)
+      REQUIRE(x[i] == d2(R2));
+    REQUIRE(R1 == R2);
+  }
+}
+
+
+template<typename dist>
+void dist_test_generate(dist &d) {
+  dist_test_generate_impl<dist, trng::lcg64_shift>(d);
+  dist_test_generate_impl<dist, trng::yarn2>(d);
+}
+
+
+// test for distributions with a sampling method other than inversion
+template<typename T>
+void continuous_dist_test_method(T &d) {
+  SECTION("chi2 test") {
+    continuous_dist_test_chi2_test(d);
+  }
+  SECTION("streamable") {
+    std::stringstream str;
+    str << d;
+    T d_new{typename T::param_type()};
+    str >> d_new;
+    REQUIRE(d == d_new);
+  }
+  SECTION("generate") {
+    dist_test_generate(d);
+  }
+}
+
+
 template<typename T>
 void continuous_dist_test(T &d) {
   SECTION("integrate pdf") {
@@ -222,6 +270,9 @@ void continuous_dist_test(T &d) {
   SECTION("streamable") {
     continuous_dist_test_streamable(d);
   }
+  SECTION("generate") {
+    dist_test_generate(d);
+  }
 }
 
 
@@ -242,7 +293,7 @@ void discrete_dist_test_pdf(dist &d) {
 
 
 // failure of the chi2 test does not necessarily imply an error, may happen just by chance
-template<typename dist>
+template<typename dist, typename engine = trng::lcg64_shift>
 void discrete_dist_test_chi2_test(dist &d) {
   using result_type = typename dist::result_type;
   std::vector<double> p;
@@ -261,7 +312,7 @@ void discrete_dist_test_chi2_test(dist &d) {
   const int bins{static_cast<int>(p.size())};
   const int N{10000};
   std::vector<int> count(bins, 0);
-  trng::lcg64_shift R(100ull);
+  engine R(100ull);
   for (int i{0}; i < N; ++i) {
     const result_type x{d(R) - d.min()};
     int bin{std::min(x, bins - 1)};
@@ -298,6 +349,32 @@ void discrete_dist_test_streamable(dist &d) {
 }
 
 
+// test for distributions with a sampling method other than inversion
+template<typename T>
+void discrete_dist_test_method(T &d) {
+  SECTION("chi2_test") {
+    discrete_dist_test_chi2_test(d);
+  }
+  SECTION("streamable") {
+    std::stringstream str;
+    str << d;
+    T d_new{typename T::param_type()};
+    str >> d_new;
+    REQUIRE(d == d_new);
+  }
+  SECTION("streamable parameters") {
+    std::stringstream str;
+    str << d.param();
+    typename T::param_type p_new;
+    str >> p_new;
+    REQUIRE(d.param() == p_new);
+  }
+  SECTION("generate") {
+    dist_test_generate(d);
+  }
+}
+
+
 template<typename T>
 void discrete_dist_test(T &d) {
   SECTION("test pdf & cdf") {
@@ -309,6 +386,9 @@ void discrete_dist_test(T &d) {
   SECTION("streamable") {
     discrete_dist_test_streamable(d);
   }
+  SECTION("generate") {
+    dist_test_generate(d);
+  }
 }
 
 
@@ -338,6 +418,12 @@ TEMPLATE_TEST_CASE("continuous distributions", "", float, double, long double) {
     continuous_dist_test(d);
   }
 
+  SECTION("normal_dist, ziggurat method") {
+    using dist = trng::normal_dist<TestType>;
+    dist d(TestType(5), TestType(2), dist::method_type::ziggurat);
+    continuous_dist_test_method(d);
+  }
+
   SECTION("truncated_normal_dist") {
     trng::truncated_normal_dist<TestType> d(TestType(5), TestType(2), TestType(2), TestType(6));
     continuous_dist_test(d);
@@ -393,16 +479,47 @@ TEMPLATE_TEST_CASE("continuous distributions", "", float, double, long double) {
     continuous_dist_test(d);
   }
 
+  SECTION("gamma_dist, Marsaglia-Tsang method") {
+    using dist = trng::gamma_dist<TestType>;
+    dist d(TestType(5), TestType(2), dist::method_type::marsaglia_tsang);
+    continuous_dist_test_method(d);
+  }
+
+  SECTION("gamma_dist, Marsaglia-Tsang method, kappa < 1") {
+    using dist = trng::gamma_dist<TestType>;
+    dist d(TestType(1) / TestType(2), TestType(2), dist::method_type::marsaglia_tsang);
+    continuous_dist_test_method(d);
+  }
+
   SECTION("beta_dist") {
     trng::beta_dist<TestType> d(TestType(3), TestType(2));
     continuous_dist_test(d);
   }
 
+  SECTION("beta_dist, gamma-ratio method") {
+    using dist = trng::beta_dist<TestType>;
+    dist d(TestType(3), TestType(2), dist::method_type::gamma_ratio);
+    continuous_dist_test_method(d);
+  }
+
+  SECTION("beta_dist, gamma-ratio method, small shape parameters") {
+    using dist = trng::beta_dist<TestType>;
+    dist d(TestType(1) / TestType(2), TestType(3) / TestType(4),
+           dist::method_type::gamma_ratio);
+    continuous_dist_test_method(d);
+  }
+
   SECTION("chi_square_dist") {
     trng::chi_square_dist<TestType> d(38);
     continuous_dist_test(d);
   }
 
+  SECTION("chi_square_dist, Marsaglia-Tsang method") {
+    using dist = trng::chi_square_dist<TestType>;
+    dist d(38, dist::method_type::marsaglia_tsang);
+    continuous_dist_test_method(d);
+  }
+
   SECTION("student_t_dist") {
     trng::student_t_dist<TestType> d(10);
     continuous_dist_test(d);
@@ -431,11 +548,26 @@ TEMPLATE_TEST_CASE("discrete distributions", "", float, double, long double) {
     discrete_dist_test(d);
   }
 
+  SECTION("uniform_int_dist, Lemire method") {
+    trng::uniform_int_dist d(8, 100, trng::uniform_int_dist::method_type::lemire);
+    discrete_dist_test_method(d);
+  }
+
   SECTION("binomial_dist") {
     trng::binomial_dist d(0.4, 20);
     discrete_dist_test(d);
   }
 
+  SECTION("binomial_dist, BTRD method") {
+    trng::binomial_dist d(0.6, 5000);
+    discrete_dist_test(d);
+  }
+
+  SECTION("binomial_dist, table-free inversion") {
+    trng::binomial_dist d(0.001, 5000);
+    discrete_dist_test(d);
+  }
+
   SECTION("negative_binomial_dist") {
     trng::negative_binomial_dist d(0.4, 20);
     discrete_dist_test(d);
@@ -456,14 +588,45 @@ TEMPLATE_TEST_CASE("discrete distributions", "", float, double, long double) {
     discrete_dist_test(d);
   }
 
+  SECTION("poisson_dist, PTRS method") {
+    trng::poisson_dist d(250.5, trng::poisson_dist::method_type::ptrs);
+    discrete_dist_test_method(d);
+  }
+
   SECTION("zero_truncated_poisson_dist") {
     trng::zero_truncated_poisson_dist d(2.125);
     discrete_dist_test(d);
   }
 
+  SECTION("zero_truncated_poisson_dist, PTRS method") {
+    using dist = trng::zero_truncated_poisson_dist;
+    dist d(12.25, dist::method_type::ptrs);
+    discrete_dist_test_method(d);
+  }
+
   SECTION("discrete_dist") {
     std::vector<int> p{1, 2, 3, 4, 5, 4, 3, 2, 1};
     trng::discrete_dist d(p.begin(), p.end());
     discrete_dist_test(d);
   }
 }
+
+
+// the Lemire method samples integers differently for engines of different output ranges
+TEMPLATE_TEST_CASE("uniform_int_dist, engine ranges", "", trng::yarn2, trng::mrg3, trng::minstd,
+                   trng::mt19937, trng::mt19937_64, trng::lcg64) {
+  using method_type = trng::uniform_int_dist::method_type;
+  SECTION("chi2_test") {
+    trng::uniform_int_dist d(8, 100, method_type::lemire);
+    discrete_dist_test_chi2_test<trng::uniform_int_dist, TestType>(d);
+  }
+
+  SECTION("large range") {
+    trng::uniform_int_dist d(-(1 << 29), 1 << 30, method_type::lemire);
+    TestType R;
+    for (int i{0}; i < 10000; ++i) {
+      const int x{d(R)};
+      REQUIRE((d.min() <= x and x <= d.max()));
+    }
+  }
+}
@@ -34,6 +34,9 @@
 #include <string>
 #include <sstream>
 #include <tuple>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
 #if defined _MSC_VER && __cplusplus <= 201703
 #include <ciso646>
 #endif
@@ -44,6 +47,8 @@
 #include <trng/lcg64_shift.hpp>
 #include <trng/lcg64_count_shift.hpp>
 #include <trng/count128_lcg_shift.hpp>
+#include <trng/philox4x32_10.hpp>
+#include <trng/threefry2x64_20.hpp>
 #include <trng/mrg2.hpp>
 #include <trng/mrg3.hpp>
 #include <trng/mrg3s.hpp>
@@ -60,9 +65,16 @@
 #include <trng/lagfib4xor.hpp>
 #include <trng/lagfib2plus.hpp>
 #include <trng/lagfib4plus.hpp>
+#include <trng/minstd.hpp>
 #include <trng/mt19937.hpp>
 #include <trng/mt19937_64.hpp>
 #include <trng/xoshiro256plus.hpp>
+#include <trng/simd_lanes.hpp>
+#include <trng/mrg_split_plan.hpp>
+#include <trng/stream_factory.hpp>
+#include <trng/parallel_generate.hpp>
+#include <trng/exponential_dist.hpp>
+#include <trng/gamma_dist.hpp>
 
 
 template<typename R>
@@ -148,9 +160,71 @@ void test_ranges_impl() {
 }
 
 
+TEST_CASE("direct bit conversion") {
+  // the opt-in bit conversion of engines with a power-of-two range yields numbers on a grid
+  // of spacing 2^-52 (double) or 2^-23 (float)
+  using u01_min = trng::utility::u01xx_traits<double, 1, generator_min<trng::lcg64>>;
+  using u01_max = trng::utility::u01xx_traits<double, 1, generator_max<trng::lcg64>>;
+  using u01f_min = trng::utility::u01xx_traits<float, 1, generator_min<trng::mt19937>>;
+  using u01f_max = trng::utility::u01xx_traits<float, 1, generator_max<trng::mt19937>>;
+  generator_min<trng::lcg64> r_min;
+  generator_max<trng::lcg64> r_max;
+  generator_min<trng::mt19937> rf_min;
+  generator_max<trng::mt19937> rf_max;
+  REQUIRE(u01_min::co_bits(r_min) == 0.0);
+  REQUIRE(u01_max::co_bits(r_max) == 1.0 - std::ldexp(1.0, -52));
+  REQUIRE(u01_min::oo_bits(r_min) == std::ldexp(1.0, -53));
+  REQUIRE(u01_max::oo_bits(r_max) == 1.0 - std::ldexp(1.0, -53));
+  REQUIRE(u01f_min::co_bits(rf_min) == 0.0f);
+  REQUIRE(u01f_max::co_bits(rf_max) == 1.0f - std::ldexp(1.0f, -23));
+  REQUIRE(u01f_min::oo_bits(rf_min) == std::ldexp(1.0f, -24));
+  // the default conversion is unchanged, 64-bit values are shifted to 63 bits and scaled
+  trng::lcg64 r1, r2;
+  const double norm{std::ldexp(1.0, -63) * (1.0 - std::ldexp(1.0, -52))};
+  for (int i{0}; i < 100; ++i) {
+    const double x{static_cast<double>(static_cast<long long>(r2() >> 1u))};
+    REQUIRE(trng::utility::uniformco<double>(r1) == x * norm);
+  }
+}
+
+
+template<typename R, typename T>
+void test_uniform_ranges_impl() {
+  R r1, r2, r3, r4;
+  advance_engine(r1, r2, 271828l);
+  advance_engine(r3, r4, 271828l);
+  std::vector<T> cc(100), co(100), oc(100), oo(100);
+  trng::utility::uniformcc<T>(r1, cc.begin(), cc.end());
+  trng::utility::uniformco<T>(r2, co.begin(), co.end());
+  trng::utility::uniformoc<T>(r3, oc.begin(), oc.end());
+  trng::utility::uniformoo<T>(r4, oo.begin(), oo.end());
+  // ranges equal consecutive single numbers
+  R r_cc, r_co, r_oc, r_oo;
+  advance_engine(r_cc, r_co, 271828l);
+  advance_engine(r_oc, r_oo, 271828l);
+  for (std::size_t i{0}; i < cc.size(); ++i) {
+    REQUIRE(cc[i] == trng::utility::uniformcc<T>(r_cc));
+    REQUIRE(co[i] == trng::utility::uniformco<T>(r_co));
+    REQUIRE(oc[i] == trng::utility::uniformoc<T>(r_oc));
+    REQUIRE(oo[i] == trng::utility::uniformoo<T>(r_oo));
+  }
+  REQUIRE((r1 == r_cc and r2 == r_co and r3 == r_oc and r4 == r_oo));
+  // direct bit to floating point conversion
+  trng::utility::uniformco_bits<T>(r1, co.begin(), co.end());
+  trng::utility::uniformoo_bits<T>(r2, oo.begin(), oo.end());
+  for (std::size_t i{0}; i < co.size(); ++i) {
+    REQUIRE(co[i] == trng::utility::uniformco_bits<T>(r_cc));
+    REQUIRE(oo[i] == trng::utility::uniformoo_bits<T>(r_co));
+    REQUIRE((0 <= co[i] and co[i] < 1 and 0 < oo[i] and oo[i] < 1));
+  }
+  REQUIRE((r1 == r_cc and r2 == r_co));
+}
+
+
 TEMPLATE_TEST_CASE("engines", "",                                            //
                    trng::lcg64, trng::lcg64_shift, trng::lcg64_count_shift,  //
                    trng::count128_lcg_shift,                                 //
+                   trng::philox4x32_10, trng::threefry2x64_20,               //
                    trng::mrg2, trng::mrg3, trng::mrg3s, trng::mrg4, trng::mrg5,
                    trng::mrg5s,  //
                    trng::yarn2, trng::yarn3, trng::yarn3s, trng::yarn4, trng::yarn5,
@@ -268,6 +342,41 @@ TEMPLATE_TEST_CASE("engines", "",                                            //
     SECTION("long double") { test_ranges_impl<TestType, long double>(); }
   }
 
+  SECTION("uniform ranges") {
+    SECTION("float") { test_uniform_ranges_impl<TestType, float>(); }
+    SECTION("double") { test_uniform_ranges_impl<TestType, double>(); }
+    SECTION("long double") { test_uniform_ranges_impl<TestType, long double>(); }
+  }
+
+  SECTION("generate") {
+    // two engines with equal state
+    GIVEN("two engines with equal state") {
+      TestType r1, r2;
+      const long n{GENERATE(0l, 1l, 31l, 1000l, 2000l)};
+      WHEN("fill buffer from one, call other repeatedly") {
+        std::vector<typename TestType::result_type> v1(n), v2;
+        r1.generate(v1.begin(), v1.end());
+        for (long i{0}; i < n; ++i)
+          v2.push_back(r2());
+        THEN("both engines yield the same values and have equal state") {
+          REQUIRE(v1 == v2);
+          REQUIRE(r1 == r2);
+        }
+      }
+      AND_WHEN("fill buffer via pointer and count") {
+        std::vector<typename TestType::result_type> v1(n + 1), v2;
+        r1.generate(v1.data(), static_cast<std::size_t>(n));
+        v1.back() = r1();
+        for (long i{0}; i <= n; ++i)
+          v2.push_back(r2());
+        THEN("both engines yield the same values and have equal state") {
+          REQUIRE(v1 == v2);
+          REQUIRE(r1 == r2);
+        }
+      }
+    }
+  }
+
   SECTION("discard") {
     // two engines with equal state
     GIVEN("two engines with equal state") {
@@ -289,6 +398,7 @@ TEMPLATE_TEST_CASE("engines", "",                                            //
 TEMPLATE_TEST_CASE("parallel engines", "",                                   //
                    trng::lcg64, trng::lcg64_shift, trng::lcg64_count_shift,  //
                    trng::count128_lcg_shift,                                 //
+                   trng::philox4x32_10, trng::threefry2x64_20,               //
                    trng::mrg2, trng::mrg3, trng::mrg3s, trng::mrg4, trng::mrg5,
                    trng::mrg5s,  //
                    trng::yarn2, trng::yarn3, trng::yarn3s, trng::yarn4, trng::yarn5,
@@ -308,6 +418,20 @@ TEMPLATE_TEST_CASE("parallel engines", "",                                   //
     }
   }
 
+  SECTION("jump") {
+    // two engines with equal state
+    GIVEN("two engines with equal state") {
+      TestType r1, r2;
+      const unsigned long long n{GENERATE(17ull, 1000003ull)};
+      WHEN("jump ahead one, advance other") {
+        r1.jump(n);
+        for (unsigned long long j{0}; j < n; ++j)
+          r2();
+        THEN("both engines have equal state") { REQUIRE(r1 == r2); }
+      }
+    }
+  }
+
   SECTION("split") {
     // two engines with equal state
     GIVEN("two engines with equal state") {
@@ -328,3 +452,444 @@ TEMPLATE_TEST_CASE("parallel engines", "",                                   //
     }
   }
 }
+
+
+TEST_CASE("counter-based engines") {
+  // known answers from the reference implementation by Salmon et al.
+  SECTION("philox4x32_10") {
+    using R = trng::philox4x32_10;
+    const trng::uint32_t k[3][2]{
+        {0u, 0u}, {0xffffffffu, 0xffffffffu}, {0xa4093822u, 0x299f31d0u}};
+    const trng::uint128 c[3]{trng::uint128{0u, 0u},
+                             trng::uint128{0xffffffffffffffffu, 0xffffffffffffffffu},
+                             trng::uint128{0x0370734413198a2eu, 0x85a308d3243f6a88u}};
+    const trng::uint32_t x_exact[3][4]{{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u},
+                                       {0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu},
+                                       {0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}};
+    for (int i{0}; i < 3; ++i) {
+      trng::uint32_t x[4][1];
+      R::blocks<1>(k[i][0], k[i][1], c[i], x);
+      for (int j{0}; j < 4; ++j)
+        REQUIRE(x[j][0] == x_exact[i][j]);
+    }
+    R r(0ull, R::parameter_type(0u, 0u));
+    for (int j{0}; j < 4; ++j)
+      REQUIRE(r() == x_exact[0][j]);
+  }
+
+  SECTION("threefry2x64_20") {
+    using R = trng::threefry2x64_20;
+    const trng::uint64_t x_exact[2]{0xc2b6e3a8c2c69865u, 0x6f81ed42f350084du};
+    trng::uint64_t x[2][1];
+    R::blocks<1>(0u, 0u, trng::uint128{0u, 0u}, x);
+    for (int j{0}; j < 2; ++j)
+      REQUIRE(x[j][0] == x_exact[j]);
+    R r(0ull, R::parameter_type(0u, 0u));
+    for (int j{0}; j < 2; ++j)
+      REQUIRE(r() == x_exact[j]);
+  }
+}
+
+
+TEMPLATE_TEST_CASE("block generation", "", trng::philox4x32_10, trng::threefry2x64_20) {
+  using R = TestType;
+  // bulk generation equals consecutive calls, for all offsets within a block and for split
+  // engines
+  const std::size_t n{GENERATE(std::size_t(0), std::size_t(1), std::size_t(7),
+                               std::size_t(64), std::size_t(100))};
+  for (unsigned int offset{0}; offset < 5; ++offset)
+    for (unsigned int s{1}; s < 3; ++s) {
+      R r1;
+      r1.split(s, s - 1);
+      r1.discard(offset);
+      const R &r0{r1};
+      R r2(r0);
+      std::vector<typename R::result_type> x(n);
+      r1.generate(x.begin(), x.end());
+      for (std::size_t i{0}; i < n; ++i)
+        REQUIRE(x[i] == r2());
+      REQUIRE(r1 == r2);
+      REQUIRE(r1() == r2());
+    }
+}
+
+
+TEMPLATE_TEST_CASE("random access", "",                                      //
+                   trng::lcg64, trng::lcg64_shift, trng::lcg64_count_shift,  //
+                   trng::count128_lcg_shift,                                 //
+                   trng::philox4x32_10, trng::threefry2x64_20) {
+  using R = TestType;
+  R r;
+  advance_engine(r, 271828l);
+  const unsigned int s{GENERATE(1u, 3u)};
+  r.split(s, s - 1);
+  // copy from a constant reference, a non-constant engine would seed the copy
+  const R &r0{r};
+  const std::vector<unsigned long long> k{0ull, 1ull, 2ull, 3ull, 15ull, 16ull, 17ull, 1000ull,
+                                          123456789ull};
+  std::vector<typename R::result_type> x(k.size());
+  r0.values_at(k.begin(), k.end(), x.begin());
+  for (std::size_t i{0}; i < k.size(); ++i) {
+    R r1(r0);
+    r1.jump(k[i]);
+    REQUIRE(r0.value_at(k[i]) == r1());
+    REQUIRE(x[i] == r0.value_at(k[i]));
+  }
+  REQUIRE(r0 == r);
+}
+
+
+template<typename R, int lanes>
+void test_simd_lanes_impl() {
+  R r1;
+  advance_engine(r1, 271828l);
+  trng::simd_lanes<R, lanes> r2(r1);
+  // single values
+  for (int i{0}; i < 3 * lanes + 1; ++i)
+    REQUIRE(r1() == r2());
+  // bulk generation starting with a partially consumed buffer
+  std::vector<typename R::result_type> v1(1000), v2(1000);
+  for (auto &x : v1)
+    x = r1();
+  r2.generate(v2.begin(), v2.end());
+  REQUIRE(v1 == v2);
+  // discard
+  const unsigned long long n{GENERATE(1ull, 7ull, 1000ull, 100003ull)};
+  r1.discard(n);
+  r2.discard(n);
+  for (int i{0}; i < 3 * lanes + 1; ++i)
+    REQUIRE(r1() == r2());
+}
+
+
+TEMPLATE_TEST_CASE("simd lanes", "",  //
+                   trng::mrg2, trng::mrg3, trng::mrg3s, trng::mrg4, trng::mrg5,
+                   trng::mrg5s,  //
+                   trng::yarn2, trng::yarn3, trng::yarn3s, trng::yarn4, trng::yarn5,
+                   trng::yarn5s) {
+  SECTION("4 lanes") { test_simd_lanes_impl<TestType, 4>(); }
+  SECTION("8 lanes") { test_simd_lanes_impl<TestType, 8>(); }
+  SECTION("13 lanes") { test_simd_lanes_impl<TestType, 13>(); }
+  SECTION("16 lanes") { test_simd_lanes_impl<TestType, 16>(); }
+}
+
+
+TEMPLATE_TEST_CASE("split plans", "",  //
+                   trng::mrg2, trng::mrg3, trng::mrg3s, trng::mrg4, trng::mrg5,
+                   trng::mrg5s,  //
+                   trng::yarn2, trng::yarn3, trng::yarn3s, trng::yarn4, trng::yarn5,
+                   trng::yarn5s) {
+  using R = TestType;
+  const unsigned int s{GENERATE(1u, 2u, 7u, 1000u, 1000003u)};
+  const trng::mrg_split_plan<R> plan(s);
+  R r;
+  advance_engine(r, 271828l);
+  // copy from a constant reference, a non-constant engine would seed the copy
+  const R &r0{r};
+  for (const unsigned int n : {0u, s / 2, s - 1}) {
+    R r1(r0), r2(r0);
+    r1.split(s, n);
+    plan.split(r2, n);
+    REQUIRE(r1 == r2);
+    for (int i{0}; i < 16; ++i)
+      REQUIRE(r1() == r2());
+  }
+  R r3(trng::mrg_split_plan<R>(2).split_parameter());
+  REQUIRE_THROWS_AS(plan.split(r3, 0), std::invalid_argument);
+  REQUIRE_THROWS_AS(plan.split(r, s), std::invalid_argument);
+}
+
+
+TEMPLATE_TEST_CASE("stream factories", "",                                   //
+                   trng::lcg64, trng::lcg64_shift, trng::lcg64_count_shift,  //
+                   trng::count128_lcg_shift,                                 //
+                   trng::philox4x32_10, trng::threefry2x64_20,               //
+                   trng::mrg2, trng::mrg3s, trng::mrg5,                      //
+                   trng::yarn2, trng::yarn3s, trng::yarn5s) {
+  using R = TestType;
+  R r;
+  advance_engine(r, 271828l);
+  // copy from a constant reference, a non-constant engine would seed the copy
+  const R &r0{r};
+  const unsigned long long b{1000003ull};
+  const unsigned int s{7};
+
+  SECTION("block") {
+    const auto streams{trng::stream_factory<R>::block(r0, b)};
+    for (const unsigned long long i : {0ull, 1ull, 2ull, 1000ull}) {
+      R r1(r0);
+      r1.jump(i * b);
+      REQUIRE(streams(i) == r1);
+    }
+  }
+
+  SECTION("leapfrog") {
+    const auto streams{trng::stream_factory<R>::leapfrog(r0, s)};
+    for (unsigned int i{0}; i < s; ++i) {
+      R r1(r0);
+      r1.split(s, i);
+      R r2(streams(i));
+      REQUIRE(r2 == r1);
+      for (int k{0}; k < 16; ++k)
+        REQUIRE(r1() == r2());
+    }
+    REQUIRE_THROWS_AS(streams(s), std::invalid_argument);
+  }
+
+  SECTION("hierarchical") {
+    const auto streams{trng::stream_factory<R>::hierarchical(r0, b, s)};
+    for (const unsigned long long i : {0ull, 1ull, 6ull, 7ull, 100ull}) {
+      R r1(r0);
+      r1.jump((i / s) * b);
+      r1.split(s, static_cast<unsigned int>(i % s));
+      REQUIRE(streams(i) == r1);
+    }
+  }
+}
+
+
+// engines without split method support block partitioning only
+TEMPLATE_TEST_CASE("block stream factories", "",  //
+                   trng::mt19937, trng::mt19937_64, trng::lagfib2plus_521_64) {
+  using R = TestType;
+  R r;
+  advance_engine(r, 271828l);
+  // copy from a constant reference, a non-constant engine would seed the copy
+  const R &r0{r};
+  const unsigned long long b{1000003ull};
+  const auto streams{trng::stream_factory<R>::block(r0, b)};
+  REQUIRE(streams.streams() == 1);
+  for (const unsigned long long i : {0ull, 1ull, 2ull, 1000ull}) {
+    R r1(r0);
+    r1.jump(i * b);
+    REQUIRE(streams(i) == r1);
+  }
+  // largest stream index whose start position is representable
+  const unsigned long long i_max{std::numeric_limits<unsigned long long>::max() / b};
+  R r1(r0);
+  r1.jump(i_max * b);
+  REQUIRE(streams(i_max) == r1);
+  REQUIRE_THROWS_AS(streams(i_max + 1), std::invalid_argument);
+}
+
+
+TEST_CASE("parallel generate") {
+  const std::size_t n{100003};
+  const unsigned int threads{GENERATE(1u, 2u, 3u, 8u)};
+
+  SECTION("engine") {
+    trng::mrg3 r1, r2;
+    std::vector<trng::mrg3::result_type> v1(n), v2(n);
+    for (auto &x : v1)
+      x = r1();
+    trng::parallel_generate(trng::parallel_policy(threads), v2.begin(), v2.end(), r2);
+    REQUIRE(v1 == v2);
+    REQUIRE(r1 == r2);
+  }
+
+  SECTION("distribution") {
+    trng::lcg64_shift r1, r2;
+    trng::exponential_dist<> d(2.5);
+    std::vector<double> v1(n), v2(n);
+    for (auto &x : v1)
+      x = d(r1);
+    REQUIRE(trng::parallel_generate_n(trng::parallel_policy(threads), v2.begin(), n, r2, d) ==
+            v2.end());
+    REQUIRE(v1 == v2);
+    REQUIRE(r1 == r2);
+  }
+
+  SECTION("several engine values per random number") {
+    // 53 random bits require two values of a 31-bit engine
+    trng::yarn2 r1, r2;
+    auto d = [](trng::yarn2 &r) { return trng::utility::generate_canonical<double, 53>(r); };
+    std::vector<double> v1(n), v2(n);
+    for (auto &x : v1)
+      x = d(r1);
+    trng::parallel_generate(trng::parallel_policy(threads, 2), v2.begin(), v2.end(), r2, d);
+    REQUIRE(v1 == v2);
+    REQUIRE(r1 == r2);
+  }
+
+  SECTION("engine without jump") {
+    // minstd discards by a loop and is used sequentially
+    trng::minstd r1, r2;
+    trng::exponential_dist<> d(2.5);
+    std::vector<double> v1(n), v2(n);
+    for (auto &x : v1)
+      x = d(r1);
+    trng::parallel_generate(trng::parallel_policy(threads), v2.begin(), v2.end(), r2, d);
+    REQUIRE(v1 == v2);
+    REQUIRE(r1 == r2);
+  }
+
+#if !(defined NDEBUG)
+  SECTION("wrong number of engine values per random number") {
+    // 53 random bits require two values of a 31-bit engine, not one
+    trng::yarn2 r;
+    auto d = [](trng::yarn2 &r) { return trng::utility::generate_canonical<double, 53>(r); };
+    std::vector<double> v(n);
+    REQUIRE_THROWS_AS(
+        trng::parallel_generate(trng::parallel_policy(threads, 1), v.begin(), v.end(), r, d),
+        std::runtime_error);
+  }
+#endif
+
+  SECTION("rejection sampling") {
+    // rejections consume a variable number of engine values per random number
+    trng::lcg64_shift r1, r2;
+    trng::gamma_dist<> d(0.75, 2.0, trng::gamma_dist<>::method_type::marsaglia_tsang);
+    REQUIRE(d.variable_draws());
+    std::vector<double> v1(n), v2(n);
+    for (auto &x : v1)
+      x = d(r1);
+    trng::parallel_generate(trng::parallel_policy(threads), v2.begin(), v2.end(), r2, d);
+    REQUIRE(v1 == v2);
+    REQUIRE(r1 == r2);
+  }
+}
+
+
+// jumps of multiple recursive generators use precomputed tables up to 2^63 steps
+TEMPLATE_TEST_CASE("jump tables", "",  //
+                   trng::mrg2, trng::mrg3, trng::mrg3s, trng::mrg4, trng::mrg5,
+                   trng::mrg5s,  //
+                   trng::yarn2, trng::yarn3, trng::yarn3s, trng::yarn4, trng::yarn5,
+                   trng::yarn5s) {
+  SECTION("jump2, large exponents") {
+    // two engines with equal state
+    GIVEN("two engines with equal state") {
+      TestType r1, r2;
+      const unsigned int i{GENERATE(31u, 62u, 63u, 64u, 70u)};
+      WHEN("jump ahead one by 2^(i+1), jump other twice by 2^i") {
+        r1.jump2(i + 1);
+        r2.jump2(i);
+        r2.jump2(i);
+        THEN("both engines have equal state") { REQUIRE(r1 == r2); }
+      }
+    }
+  }
+
+  SECTION("split engines") {
+    // split engines have parameter sets and jump tables of their own
+    GIVEN("two split engines with equal state") {
+      TestType r1, r2;
+      r1.split(3, 1);
+      r2.split(3, 1);
+      const unsigned long long n{GENERATE(16ull, 1000ull, 100003ull)};
+      WHEN("jump ahead one, advance other") {
+        r1.jump(n);
+        for (unsigned long long j{0}; j < n; ++j)
+          r2();
+        THEN("both engines have equal state") { REQUIRE(r1 == r2); }
+      }
+    }
+  }
+
+  SECTION("evicted jump tables") {
+    // more parameter sets than cached jump tables
+    for (unsigned int s{2}; s < 300; ++s) {
+      TestType r1, r2;
+      r1.split(s, 1);
+      r2.split(s, 1);
+      const unsigned long long n{4099};
+      r1.jump(n);
+      for (unsigned long long j{0}; j < n; ++j)
+        r2();
+      REQUIRE(r1 == r2);
+    }
+  }
+}
+
+
+// Mersenne twisters jump ahead via the characteristic polynomial of the state transition
+TEMPLATE_TEST_CASE("GF(2) jump", "",  //
+                   trng::mt19937, trng::mt19937_64) {
+  SECTION("jump") {
+    // two engines with equal state
+    GIVEN("two engines with equal state") {
+      TestType r1, r2;
+      const long pre{GENERATE(0l, 1l, 400l)};
+      advance_engine(r1, r2, pre);
+      const unsigned long long n{GENERATE(1ull, 623ull, 624ull, 1000ull, 3000017ull)};
+      WHEN("jump ahead one, advance other") {
+        r1.jump(typename TestType::jump_polynomial(n));
+        for (unsigned long long j{0}; j < n; ++j)
+          r2();
+        THEN("both engines yield the same values") {
+          REQUIRE(r1 == r2);
+          const auto v{generate_list(r1, r2, 2000)};
+          REQUIRE(std::get<0>(v) == std::get<1>(v));
+        }
+      }
+    }
+  }
+
+  SECTION("jump2, large exponents") {
+    // two engines with equal state
+    GIVEN("two engines with equal state") {
+      TestType r1, r2;
+      const unsigned int i{GENERATE(21u, 63u, 64u, 70u)};
+      WHEN("jump ahead one by 2^(i+1), jump other twice by 2^i") {
+        r1.jump2(i + 1);
+        r2.jump2(i);
+        r2.jump2(i);
+        THEN("both engines yield the same values") {
+          const auto v{generate_list(r1, r2, 2000)};
+          REQUIRE(std::get<0>(v) == std::get<1>(v));
+        }
+      }
+    }
+  }
+}
+
+
+// additive lagged Fibonacci generators jump ahead via the characteristic polynomial of the
+// recurrence
+TEMPLATE_TEST_CASE("lagged Fibonacci jump", "",                          //
+                   trng::lagfib2plus_521_32, trng::lagfib2plus_607_64,  //
+                   trng::lagfib4plus_521_64, trng::lagfib4plus_1279_32) {
+  SECTION("jump2") {
+    // two engines with equal state
+    GIVEN("two engines with equal state") {
+      TestType r1, r2;
+      const long i{GENERATE(range(0l, 25l))};
+      const long n{1l << i};
+      WHEN("jump ahead one, advance other") {
+        r1.jump2(i);
+        for (long j{0l}; j < n; ++j)
+          r2();
+        THEN("both engines have equal state") { REQUIRE(r1 == r2); }
+      }
+    }
+  }
+
+  SECTION("jump") {
+    // two engines with equal state
+    GIVEN("two engines with equal state") {
+      TestType r1, r2;
+      advance_engine(r1, r2, 400l);
+      const unsigned long long n{GENERATE(1ull, 521ull, 3000017ull, 40000003ull)};
+      WHEN("jump ahead one, advance other") {
+        r1.jump(n);
+        for (unsigned long long j{0}; j < n; ++j)
+          r2();
+        THEN("both engines have equal state") { REQUIRE(r1 == r2); }
+      }
+    }
+  }
+
+  SECTION("jump2, large exponents") {
+    // two engines with equal state
+    GIVEN("two engines with equal state") {
+      TestType r1, r2;
+      const unsigned int i{GENERATE(30u, 63u, 64u, 70u)};
+      WHEN("jump ahead one by 2^(i+1), jump other twice by 2^i") {
+        r1.jump2(i + 1);
+        r2.jump2(i);
+        r2.jump2(i);
+        THEN("both engines have equal state") { REQUIRE(r1 == r2); }
+      }
+    }
+  }
+}
@@ -35,6 +35,7 @@
 #include <tuple>
 #include <utility>
 #include <limits>
+#include <memory>
 #include <cmath>
 #if defined _MSC_VER && __cplusplus <= 201703
 #include <ciso646>
@@ -94,6 +95,9 @@ TEST_CASE("linear algebra") {
     trng::int_math::matrix_vec_mult<n>(A, b, c, m);
     for (int i{0}; i < n; ++i)
       REQUIRE(c[i] == c_exact[i]);
+    trng::int_math::matrix_vec_mult<n, m>(A, b, c);
+    for (int i{0}; i < n; ++i)
+      REQUIRE(c[i] == c_exact[i]);
   }
 
   SECTION("matrix matrix multiplication") {
@@ -117,6 +121,40 @@ TEST_CASE("linear algebra") {
     trng::int_math::matrix_mult<3>(A, B, C, m);
     for (int i{0}; i < n * n; ++i)
       REQUIRE(C[i] == C_exact[i]);
+    trng::int_math::matrix_mult<3, m>(A, B, C);
+    for (int i{0}; i < n * n; ++i)
+      REQUIRE(C[i] == C_exact[i]);
+  }
+
+  SECTION("matrix products with large modulus") {
+    const int n{5};
+    const trng::int32_t m{2147483647};
+    trng::int32_t A[n * n], B[n * n], b[n];
+    for (int i{0}; i < n * n; ++i) {
+      A[i] = m - 1 - i;
+      B[i] = static_cast<trng::int32_t>((1234567ll * (i + 1)) % m);
+    }
+    for (int i{0}; i < n; ++i)
+      b[i] = m - 1 - 3 * i;
+    trng::int32_t C[n * n], C_static[n * n], c[n], c_static[n];
+    trng::int_math::matrix_mult<n>(A, B, C, m);
+    trng::int_math::matrix_mult<n, m>(A, B, C_static);
+    trng::int_math::matrix_vec_mult<n>(A, b, c, m);
+    trng::int_math::matrix_vec_mult<n, m>(A, b, c_static);
+    for (int j{0}; j < n; ++j) {
+      trng::int64_t t{0};
+      for (int k{0}; k < n; ++k)
+        t = (t + static_cast<trng::int64_t>(A[j * n + k]) * b[k]) % m;
+      REQUIRE(c[j] == t);
+      REQUIRE(c_static[j] == t);
+      for (int i{0}; i < n; ++i) {
+        t = 0;
+        for (int k{0}; k < n; ++k)
+          t = (t + static_cast<trng::int64_t>(A[j * n + k]) * B[k * n + i]) % m;
+        REQUIRE(C[j * n + i] == t);
+        REQUIRE(C_static[j * n + i] == t);
+      }
+    }
   }
 
   SECTION("Gaussian elimination") {
@@ -176,6 +214,27 @@ TEST_CASE("linear algebra") {
 }
 
 
+TEST_CASE("Barrett reduction") {
+  const trng::int32_t m{GENERATE(trng::int32_t(2), trng::int32_t(7), trng::int32_t(65536),
+                                 trng::int32_t(2147462579), trng::int32_t(2147483647))};
+  const trng::int_math::barrett M(m);
+  const trng::uint64_t m1{static_cast<trng::uint64_t>(m) - 1u};
+  // products of residues, small values and values near multiples of m
+  for (trng::uint64_t x{0}; x < 1000 and x <= m1; ++x) {
+    for (const trng::uint64_t y : {x, m1 - x, m1})
+      REQUIRE(M.mult(static_cast<trng::int32_t>(x), static_cast<trng::int32_t>(y)) ==
+              static_cast<trng::int32_t>((x * y) % m));
+    for (const trng::uint64_t y : {x, x * m, x * m + m1})
+      if (y <= m1 * m1)
+        REQUIRE(M.modulo(y) == static_cast<trng::int32_t>(y % m));
+  }
+  // full 64-bit range
+  for (trng::uint64_t x{1}; x != 0; x <<= 1u)
+    for (const trng::uint64_t y : {x - 1, x, x + 1, ~x, 0 - x})
+      REQUIRE(M.reduce(y) == static_cast<trng::int32_t>(y % m));
+}
+
+
 TEST_CASE("modulo inverse") {
   SECTION("prime modulus") {
     const long m{104729};  // must be prime
@@ -195,3 +254,28 @@ TEST_CASE("modulo inverse") {
     REQUIRE_THROWS_AS(trng::int_math::modulo_inverse(100, m), std::exception);
   }
 }
+
+
+template<typename power>
+void test_power_impl() {
+  const trng::int32_t m{2147461007}, b{889744251};
+  std::unique_ptr<power> g(new power);
+  const trng::int32_t n[]{0, 1, 2, 15, 16, 0x7ff, 0x800, 0xffff, 0x10000, 0x3fffff, 0x400000,
+                          123456789, 0x7ffffffe, 0x7fffffff};
+  for (auto i : n)
+    REQUIRE((*g)(i) == trng::int_math::power_mod<m>(b, i));
+}
+
+
+TEST_CASE("modular exponentiation") {
+  const trng::int32_t m{2147461007}, b{889744251};
+  SECTION("power_mod") {
+    REQUIRE(trng::int_math::power_mod<m>(b, 0) == 1);
+    REQUIRE(trng::int_math::power_mod<m>(b, 1) == b);
+    // Fermat's little theorem
+    REQUIRE(trng::int_math::power_mod<m>(b, m - 1) == 1);
+  }
+  SECTION("power_table_2x16") { test_power_impl<trng::int_math::power_table_2x16<m, b>>(); }
+  SECTION("power_table_3x11") { test_power_impl<trng::int_math::power_table_3x11<m, b>>(); }
+  SECTION("power_window") { test_power_impl<trng::int_math::power_window<m, b>>(); }
+}
@@ -38,6 +38,8 @@
 #include <catch2/catch_all.hpp>
 
 #include <trng/linear_algebra.hpp>
+#include <trng/gf2_polynomial.hpp>
+#include <vector>
 
 TEST_CASE("basic vector operations") {
   SECTION("comparison operations") {
@@ -137,4 +139,56 @@ TEST_CASE("GF(2)") {
     auto A_8_2{trng::power(A, 8)};
     REQUIRE(A_8_2 == A_8);
   }
+
+  SECTION("bit-packed matrix products") {
+    // products of bit-packed matrices equal integer products modulo two
+    auto a = [](std::size_t i, std::size_t j) { return int((i * i + 3 * j + i * j) % 7 < 3); };
+    auto b = [](std::size_t i, std::size_t j) { return int((5 * i + j * j) % 5 < 2); };
+    const trng::matrix<int, 131> A_int(a), B_int(b), C_int(A_int * B_int);
+    const trng::matrix<trng::GF2, 131> A(
+        [&](std::size_t i, std::size_t j) { return trng::GF2(a(i, j)); });
+    const trng::matrix<trng::GF2, 131> B(
+        [&](std::size_t i, std::size_t j) { return trng::GF2(b(i, j)); });
+    const trng::matrix<trng::GF2, 131> C(A * B);
+    for (std::size_t i{0}; i < 131; ++i)
+      for (std::size_t j{0}; j < 131; ++j)
+        REQUIRE(C(i, j) == trng::GF2(C_int(i, j) % 2));
+    const trng::vector<unsigned int, 131> v([](std::size_t i) { return 1u << (i % 32); });
+    const trng::vector<unsigned int, 131> w(A * v);
+    for (std::size_t i{0}; i < 131; ++i) {
+      unsigned int sum{0};
+      for (std::size_t j{0}; j < 131; ++j)
+        if (a(i, j) == 1)
+          sum ^= v(j);
+      REQUIRE(w(i) == sum);
+    }
+  }
+}
+
+
+TEST_CASE("GF(2) polynomials") {
+  // primitive trinomial x^31 + x^3 + 1
+  const trng::gf2_polynomial f{31, 3, 0};
+
+  SECTION("minimal polynomial") {
+    // sequence of the linear feedback shift register s_{k + 31} = s_{k + 3} + s_k
+    std::vector<bool> s(100, false);
+    s[0] = true;
+    for (std::size_t k{31}; k < s.size(); ++k)
+      s[k] = s[k - 28] != s[k - 31];
+    REQUIRE(trng::gf2_polynomial::minimal_polynomial(s) == f);
+  }
+
+  SECTION("powers of x") {
+    REQUIRE(power_x_mod(0, f) == trng::gf2_polynomial{0});
+    REQUIRE(power_x_mod(30, f) == trng::gf2_polynomial{30});
+    REQUIRE(power_x_mod(31, f) == (trng::gf2_polynomial{3, 0}));
+    REQUIRE(power_x_mod(34, f) == (trng::gf2_polynomial{6, 3}));
+    // x is a generator of the multiplicative group of order 2^31 - 1
+    REQUIRE(power_x_mod(2147483647ull, f) == trng::gf2_polynomial{0});
+    REQUIRE(power2_x_mod(31, f) == trng::gf2_polynomial{1});
+    REQUIRE(power2_x_mod(20, f) == power_x_mod(1ull << 20u, f));
+    REQUIRE(div_x_mod(power_x_mod(12345, f), f) == power_x_mod(12344, f));
+    REQUIRE(div_x_mod(trng::gf2_polynomial{0}, f) == power_x_mod(2147483646ull, f));
+  }
 }
@@ -45,6 +45,7 @@
 #include <catch2/catch_all.hpp>
 
 #include <trng/special_functions.hpp>
+#include <trng/simd_math.hpp>
 
 
 template<typename T, std::size_t n>
@@ -125,6 +126,15 @@ void check_function(const T_ref &x_yref, const T y) {
 }
 
 
+template<typename T, typename F_array, typename F_scalar>
+void check_array_function(const std::vector<T> &x, F_array f_array, F_scalar f_scalar) {
+  std::vector<T> y(x.size());
+  f_array(x.data(), x.data() + x.size(), y.data());
+  for (std::size_t i{0}; i < x.size(); ++i)
+    check_function(arg_res_tuple<T, 1>{x[i], f_scalar(x[i])}, y[i]);
+}
+
+
 TEMPLATE_TEST_CASE("special_functions", "", float, double, long double) {
   using T = TestType;
 
@@ -537,3 +547,120 @@ TEMPLATE_TEST_CASE("special_functions", "", float, double, long double) {
     check_function(x_yref, y);
   }
 }
+
+
+TEMPLATE_TEST_CASE("vectorized special functions", "", float, double) {
+  using T = TestType;
+  using limits = std::numeric_limits<T>;
+  // arguments beyond x_max give subnormal or vanishing results of erfc
+  const T x_max{std::sqrt(-std::log(limits::min()))};
+  auto grid = [](T first, T last, T step) {
+    std::vector<T> x;
+    for (T x_i{first}; x_i <= last; x_i += step)
+      x.push_back(x_i);
+    return x;
+  };
+
+  SECTION("ln") {
+    std::vector<T> x;
+    for (T x_i{limits::denorm_min()}; x_i < limits::min(); x_i *= 3)
+      x.push_back(x_i);
+    for (T x_i{limits::min()}; x_i < limits::max() / 2; x_i *= T(1.37))
+      x.push_back(x_i);
+    const std::vector<T> x_1{grid(T(0.5), T(2), T(1) / T(1024))};
+    x.insert(x.end(), x_1.begin(), x_1.end());
+    check_array_function(
+        x, [](const T *first, const T *last, T *out) { trng::math::ln(first, last, out); },
+        [](T x) { return trng::math::ln(x); });
+  }
+
+  SECTION("exp") {
+    const T x_exp{T(0.69) * limits::max_exponent};
+    check_array_function(
+        grid(-x_exp, x_exp, T(0.37)),
+        [](const T *first, const T *last, T *out) { trng::math::exp(first, last, out); },
+        [](T x) { return trng::math::exp(x); });
+  }
+
+  SECTION("erf") {
+    check_array_function(
+        grid(T(-6), T(6), T(1) / T(64)),
+        [](const T *first, const T *last, T *out) { trng::math::erf(first, last, out); },
+        [](T x) { return trng::math::erf(x); });
+  }
+
+  SECTION("erfc") {
+    check_array_function(
+        grid(T(-6), x_max, T(1) / T(64)),
+        [](const T *first, const T *last, T *out) { trng::math::erfc(first, last, out); },
+        [](T x) { return trng::math::erfc(x); });
+  }
+
+  SECTION("Phi") {
+    check_array_function(
+        grid(-x_max * trng::math::constants<T>::sqrt_2, T(8), T(1) / T(64)),
+        [](const T *first, const T *last, T *out) { trng::math::Phi(first, last, out); },
+        [](T x) { return trng::math::Phi(x); });
+  }
+
+  SECTION("inv_Phi") {
+    std::vector<T> x{grid(T(1) / T(64), T(63) / T(64), T(1) / T(64))};
+    for (int k{1}; k < limits::digits; ++k) {
+      x.push_back(std::ldexp(T(1), -k));
+      x.push_back(1 - std::ldexp(T(1), -k));
+    }
+    for (int k{limits::digits}; k < -limits::min_exponent; k += 7)
+      x.push_back(std::ldexp(T(1), -k));
+    check_array_function(
+        x, [](const T *first, const T *last, T *out) { trng::math::inv_Phi(first, last, out); },
+        [](T x) { return trng::math::inv_Phi(x); });
+  }
+
+  SECTION("special values") {
+    const T inf{limits::infinity()}, nan{limits::quiet_NaN()};
+    const std::vector<T> x{-inf, -1, 0, 1, inf, nan};
+    std::vector<T> y(x.size());
+    trng::math::ln(x.data(), x.data() + x.size(), y.data());
+    REQUIRE(std::isnan(y[0]));
+    REQUIRE(std::isnan(y[1]));
+    REQUIRE(y[2] == -inf);
+    REQUIRE(y[3] == 0);
+    REQUIRE(y[4] == inf);
+    REQUIRE(std::isnan(y[5]));
+    trng::math::exp(x.data(), x.data() + x.size(), y.data());
+    REQUIRE(y[0] == 0);
+    REQUIRE(y[2] == 1);
+    REQUIRE(y[4] == inf);
+    REQUIRE(std::isnan(y[5]));
+    trng::math::erf(x.data(), x.data() + x.size(), y.data());
+    REQUIRE(y[0] == -1);
+    REQUIRE(y[2] == 0);
+    REQUIRE(y[4] == 1);
+    REQUIRE(std::isnan(y[5]));
+    trng::math::erfc(x.data(), x.data() + x.size(), y.data());
+    REQUIRE(y[0] == 2);
+    REQUIRE(y[2] == 1);
+    REQUIRE(y[4] == 0);
+    REQUIRE(std::isnan(y[5]));
+    trng::math::Phi(x.data(), x.data() + x.size(), y.data());
+    REQUIRE(y[0] == 0);
+    REQUIRE(y[2] == T(0.5));
+    REQUIRE(y[4] == 1);
+    REQUIRE(std::isnan(y[5]));
+    trng::math::inv_Phi(x.data(), x.data() + x.size(), y.data());
+    REQUIRE(std::isnan(y[0]));
+    REQUIRE(std::isnan(y[1]));
+    REQUIRE(y[2] == -inf);
+    REQUIRE(y[3] == inf);
+    REQUIRE(std::isnan(y[4]));
+    REQUIRE(std::isnan(y[5]));
+  }
+
+  SECTION("in place") {
+    std::vector<T> x{grid(T(-3), T(3), T(1) / T(8))};
+    const std::vector<T> x_orig{x};
+    trng::math::Phi(x.data(), x.data() + x.size(), x.data());
+    for (std::size_t i{0}; i < x.size(); ++i)
+      check_function(arg_res_tuple<T, 1>{x_orig[i], trng::math::Phi(x_orig[i])}, x[i]);
+  }
+}
@@ -166,6 +166,12 @@ namespace trng {
       bernoulli_dist g(P);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      utility::generate_transformed<utility::u01_interval::co, double>(
+          r, first, last, [this](double u) { return u < P.p() ? P.head() : P.tail(); });
+    }
     // property methods
     TRNG_CUDA_ENABLE
     T min() const {
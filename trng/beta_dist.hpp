@@ -40,6 +40,7 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/gamma_dist.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -56,9 +57,16 @@ namespace trng {
   public:
     using result_type = float_t;
 
+    // sampling methods, inversion of the cumulative density function is the default
+    enum class method_type { inversion, gamma_ratio };
+
     class param_type {
     private:
+      using gamma_param_type = typename gamma_dist<result_type>::param_type;
+
       result_type alpha_{1}, beta_{1}, norm_{math::Beta(alpha_, beta_)};
+      // parameters of the gamma variates of the gamma-ratio method
+      gamma_param_type gamma_alpha_{alpha_, 1}, gamma_beta_{beta_, 1};
 
     public:
       TRNG_CUDA_ENABLE
@@ -75,11 +83,13 @@ namespace trng {
       void alpha(result_type alpha_new) {
         alpha_ = alpha_new;
         norm_ = math::Beta(alpha_, beta_);
+        gamma_alpha_.kappa(alpha_);
       }
       TRNG_CUDA_ENABLE
       void beta(result_type beta_new) {
         beta_ = beta_new;
         norm_ = math::Beta(alpha_, beta_);
+        gamma_beta_.kappa(beta_);
       }
       param_type() = default;
       TRNG_CUDA_ENABLE
@@ -127,27 +137,61 @@ namespace trng {
 
   private:
     param_type P;
+    method_type M{method_type::inversion};
+
+    // X / (X + Y) is beta distributed if X and Y are independent gamma variates with shape
+    // parameters alpha and beta and common scale parameter
+    template<typename R>
+    TRNG_CUDA_ENABLE result_type gamma_ratio(R &r) const {
+      using gamma_method_type = typename gamma_dist<result_type>::method_type;
+      gamma_dist<result_type> g(P.gamma_alpha_, gamma_method_type::marsaglia_tsang);
+      while (true) {
+        const result_type x{g(r, P.gamma_alpha_)};
+        const result_type y{g(r, P.gamma_beta_)};
+        // both variates may underflow for very small shape parameters
+        if (x + y > 0)
+          return x / (x + y);
+      }
+    }
 
   public:
     // constructor
     TRNG_CUDA_ENABLE
-    explicit beta_dist(result_type alpha, result_type beta) : P{alpha, beta} {}
+    explicit beta_dist(result_type alpha, result_type beta,
+                       method_type M = method_type::inversion)
+        : P{alpha, beta}, M{M} {}
     TRNG_CUDA_ENABLE
-    explicit beta_dist(const param_type &P) : P{P} {}
+    explicit beta_dist(const param_type &P, method_type M = method_type::inversion)
+        : P{P}, M{M} {}
     // reset internal state
     TRNG_CUDA_ENABLE
     void reset() {}
     // random numbers
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
+      if (M == method_type::gamma_ratio)
+        return gamma_ratio(r);
       return math::inv_Beta_I(utility::uniformoo<result_type>(r), P.alpha(), P.beta(),
                               P.norm());
     }
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &P) {
-      beta_dist g(P);
+      beta_dist g(P, M);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      if (M == method_type::gamma_ratio) {
+        for (; first != last; ++first)
+          *first = (*this)(r);
+        return;
+      }
+      utility::generate_transformed<utility::u01_interval::oo, result_type>(
+          r, first, last, [this](result_type u) {
+            return math::inv_Beta_I(u, P.alpha(), P.beta(), P.norm());
+          });
+    }
     // property methods
     TRNG_CUDA_ENABLE
     result_type min() const { return result_type(0); }
@@ -158,6 +202,13 @@ namespace trng {
     TRNG_CUDA_ENABLE
     void param(const param_type &P_new) { P = P_new; }
     TRNG_CUDA_ENABLE
+    method_type method() const { return M; }
+    TRNG_CUDA_ENABLE
+    void method(method_type M_new) { M = M_new; }
+    // the ratio of two gamma variates consumes a variable number of engine values
+    TRNG_CUDA_ENABLE
+    bool variable_draws() const { return M == method_type::gamma_ratio; }
+    TRNG_CUDA_ENABLE
     result_type alpha() const { return P.alpha(); }
     TRNG_CUDA_ENABLE
     result_type beta() const { return P.beta(); }
@@ -206,13 +257,13 @@ namespace trng {
   template<typename float_t>
   TRNG_CUDA_ENABLE inline bool operator==(const beta_dist<float_t> &g1,
                                           const beta_dist<float_t> &g2) {
-    return g1.param() == g2.param();
+    return g1.param() == g2.param() and g1.method() == g2.method();
   }
 
   template<typename float_t>
   TRNG_CUDA_ENABLE inline bool operator!=(const beta_dist<float_t> &g1,
                                           const beta_dist<float_t> &g2) {
-    return g1.param() != g2.param();
+    return not(g1 == g2);
   }
 
   // Streamable concept
@@ -221,7 +272,10 @@ namespace trng {
                                                    const beta_dist<float_t> &g) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    out << "[beta " << g.param() << ']';
+    out << "[beta " << g.param();
+    if (g.method() == beta_dist<float_t>::method_type::gamma_ratio)
+      out << " gamma_ratio";
+    out << ']';
     out.flags(flags);
     return out;
   }
@@ -229,12 +283,21 @@ namespace trng {
   template<typename char_t, typename traits_t, typename float_t>
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
                                                    beta_dist<float_t> &g) {
+    using method_type = typename beta_dist<float_t>::method_type;
     typename beta_dist<float_t>::param_type P;
+    method_type m{method_type::inversion};
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    in >> utility::ignore_spaces() >> utility::delim("[beta ") >> P >> utility::delim(']');
-    if (in)
+    in >> utility::ignore_spaces() >> utility::delim("[beta ") >> P;
+    if (in and in.peek() == ' ') {
+      in >> utility::delim(" gamma_ratio");
+      m = method_type::gamma_ratio;
+    }
+    in >> utility::delim(']');
+    if (in) {
       g.param(P);
+      g.method(m);
+    }
     in.flags(flags);
     return in;
   }
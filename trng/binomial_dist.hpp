@@ -37,6 +37,8 @@
 #include <trng/limits.hpp>
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
+#include <trng/special_functions.hpp>
+#include <trng/constants.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -52,14 +54,47 @@ namespace trng {
   public:
     using result_type = int;
 
+    // largest number of trials for which random numbers are generated via a table of the
+    // cumulative density function, larger n are handled by table-free methods
+    static constexpr int table_n_max{1024};
+
     class param_type {
     private:
       double p_{0.5};
       int n_{0};
       std::vector<double> P_;
+      // constants of the table-free methods, which generate random numbers for
+      // min(p, 1 - p) and reflect the result if p > 1/2
+      double p_min_{0}, q_n_{0}, r_{0}, nr_{0}, npq_{0}, a_{0}, b_{0}, c_{0}, alpha_{0},
+          v_r_{0}, u_rv_r_{0};
+      int m_{0};
+
+      bool table() const { return n_ <= table_n_max; }
+      // the BTRD method requires a mode of at least 11, sequential inversion is used otherwise
+      bool btrd() const { return m_ >= 11; }
+
+      void calc_constants() {
+        p_min_ = p_ <= 0.5 ? p_ : 1.0 - p_;
+        m_ = static_cast<int>((n_ + 1.0) * p_min_);
+        q_n_ = math::exp(n_ * math::ln1p(-p_min_));
+        r_ = p_min_ / (1.0 - p_min_);
+        nr_ = (n_ + 1.0) * r_;
+        npq_ = n_ * p_min_ * (1.0 - p_min_);
+        const double sqrt_npq{math::sqrt(npq_)};
+        b_ = 1.15 + 2.53 * sqrt_npq;
+        a_ = -0.0873 + 0.0248 * b_ + 0.01 * p_min_;
+        c_ = n_ * p_min_ + 0.5;
+        alpha_ = (2.83 + 5.1 / b_) * sqrt_npq;
+        v_r_ = 0.92 - 4.2 / b_;
+        u_rv_r_ = 0.86 * v_r_;
+      }
 
       void calc_probabilities() {
         P_ = std::vector<double>();
+        if (not table()) {
+          calc_constants();
+          return;
+        }
         P_.reserve(n_ + 1);
         double ln_binom{0.0};
         const double ln_p{math::ln(p_)};
@@ -98,6 +133,118 @@ namespace trng {
   private:
     param_type P;
 
+    // error of Stirling's approximation, ln(n!) - (n + 1/2) ln(n) + n - ln(2 pi) / 2
+    static double stirling_error(double n) {
+      if (n <= 15)
+        return math::ln_Gamma(n + 1) - (n + 0.5) * math::ln(n) + n -
+               math::ln(math::constants<double>::sqrt_2pi);
+      const double s0{1.0 / 12}, s1{1.0 / 360}, s2{1.0 / 1260}, s3{1.0 / 1680},
+          s4{1.0 / 1188};
+      const double nn{n * n};
+      if (n > 500)
+        return (s0 - s1 / nn) / n;
+      if (n > 80)
+        return (s0 - (s1 - s2 / nn) / nn) / n;
+      if (n > 35)
+        return (s0 - (s1 - (s2 - s3 / nn) / nn) / nn) / n;
+      return (s0 - (s1 - (s2 - (s3 - s4 / nn) / nn) / nn) / nn) / n;
+    }
+
+    // deviance term x ln(x / np) + np - x, evaluated by a series for x close to np
+    static double deviance(double x, double np) {
+      if (math::abs(x - np) < 0.1 * (x + np)) {
+        double v{(x - np) / (x + np)};
+        double s{(x - np) * v}, ej{2 * x * v};
+        v *= v;
+        for (int j{1}; j < 1000; ++j) {
+          ej *= v;
+          const double s_new{s + ej / (2 * j + 1)};
+          if (s_new == s)
+            break;
+          s = s_new;
+        }
+        return s;
+      }
+      return x * math::ln(x / np) + np - x;
+    }
+
+    // sequential search inversion without table for distributions with small mode
+    template<typename R>
+    int inversion(R &r) const {
+      double u{utility::uniformco<double>(r)};
+      double prob{P.q_n_};
+      int x{0};
+      while (u > prob and x < P.n_) {
+        u -= prob;
+        ++x;
+        const double prob_new{(P.nr_ / x - P.r_) * prob};
+        // terms become negligible in the far tail
+        if (prob_new < math::numeric_limits<double>::epsilon() and prob_new < prob)
+          break;
+        prob = prob_new;
+      }
+      return x;
+    }
+
+    // W. Hoermann, ``The generation of binomial random variates''
+    // Journal of Statistical Computation and Simulation 46 (1993) 101--110
+    template<typename R>
+    int btrd(R &r) const {
+      const int n{P.n_}, m{P.m_};
+      while (true) {
+        double v{utility::uniformco<double>(r)};
+        double u;
+        if (v <= P.u_rv_r_) {
+          u = v / P.v_r_ - 0.43;
+          return static_cast<int>(
+              math::floor((2 * P.a_ / (0.5 - math::abs(u)) + P.b_) * u + P.c_));
+        }
+        if (v >= P.v_r_) {
+          u = utility::uniformco<double>(r) - 0.5;
+        } else {
+          u = v / P.v_r_ - 0.93;
+          u = (u < 0 ? -0.5 : 0.5) - u;
+          v = utility::uniformco<double>(r) * P.v_r_;
+        }
+        const double us{0.5 - math::abs(u)};
+        const double k_d{math::floor((2 * P.a_ / us + P.b_) * u + P.c_)};
+        if (k_d < 0 or k_d > n)
+          continue;
+        const int k{static_cast<int>(k_d)};
+        v *= P.alpha_ / (P.a_ / (us * us) + P.b_);
+        const int km{k > m ? k - m : m - k};
+        if (km <= 15) {
+          // recursive evaluation of the probability ratio
+          double f{1};
+          if (m < k) {
+            for (int i{m + 1}; i <= k; ++i)
+              f *= P.nr_ / i - P.r_;
+          } else if (m > k) {
+            for (int i{k + 1}; i <= m; ++i)
+              v *= P.nr_ / i - P.r_;
+          }
+          if (v <= f)
+            return k;
+          continue;
+        }
+        // squeeze acceptance and rejection
+        v = math::ln(v);
+        const double rho{(km / P.npq_) * (((km / 3.0 + 0.625) * km + 1.0 / 6) / P.npq_ + 0.5)};
+        const double t{-static_cast<double>(km) * km / (2 * P.npq_)};
+        if (v < t - rho)
+          return k;
+        if (v > t + rho)
+          continue;
+        // final acceptance and rejection step
+        const double nm{n - m + 1.0}, nk{n - k + 1.0};
+        const double h{(m + 0.5) * math::ln((m + 1) / (P.r_ * nm)) +
+                       stirling_error(m + 1.0) + stirling_error(n - m + 1.0)};
+        if (v <= h + (n + 1) * math::ln(nm / nk) + (k + 0.5) * math::ln(nk * P.r_ / (k + 1)) -
+                      stirling_error(k + 1.0) - stirling_error(n - k + 1.0))
+          return k;
+      }
+    }
+
   public:
     // constructor
     explicit binomial_dist(double p, int n) : P{p, n} {}
@@ -107,6 +254,10 @@ namespace trng {
     // random numbers
     template<typename R>
     int operator()(R &r) {
+      if (not P.table()) {
+        const int x{P.btrd() ? btrd(r) : inversion(r)};
+        return P.p_ <= 0.5 ? x : P.n_ - x;
+      }
       return static_cast<int>(
           utility::discrete(utility::uniformoo<double>(r), P.P_.begin(), P.P_.end()));
     }
@@ -115,6 +266,12 @@ namespace trng {
       binomial_dist g(P);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      for (; first != last; ++first)
+        *first = (*this)(r);
+    }
     // property methods
     int min() const { return 0; }
     int max() const { return P.n(); }
@@ -124,10 +281,29 @@ namespace trng {
     void p(double p_new) { P.p(p_new); }
     int n() const { return P.n(); }
     void n(int n_new) { P.n(n_new); }
+    // rejections of the BTRD method consume additional engine values
+    bool variable_draws() const { return not P.table() and P.btrd(); }
     // probability density function
     double pdf(int x) const {
       if (x < 0 or x > P.n())
         return 0.0;
+      if (not P.table()) {
+        if (P.p() == 0 or P.p() == 1)
+          return x == (P.p() == 0 ? 0 : P.n()) ? 1.0 : 0.0;
+        const double n{static_cast<double>(P.n())};
+        if (x == 0)
+          return math::exp(n * math::ln1p(-P.p()));
+        if (x == P.n())
+          return math::exp(n * math::ln(P.p()));
+        // saddle point expansion, C. Loader, ``Fast and Accurate Computation of Binomial
+        // Probabilities'' (2000), avoids cancellations of logarithms of large factorials
+        const double k{static_cast<double>(x)};
+        const double ln_c{stirling_error(n) - stirling_error(k) - stirling_error(n - k) -
+                          deviance(k, n * P.p()) - deviance(n - k, n * (1.0 - P.p()))};
+        const double ln_f{2 * math::ln(math::constants<double>::sqrt_2pi) + math::ln(k) +
+                          math::ln1p(-k / n)};
+        return math::exp(ln_c - ln_f / 2);
+      }
       if (x == 0)
         return P.P_[0];
       return P.P_[x] - P.P_[x - 1];
@@ -136,9 +312,31 @@ namespace trng {
     double cdf(int x) const {
       if (x < 0)
         return 0.0;
-      if (x <= P.n())
+      if (x >= P.n())
+        return 1.0;
+      if (P.table())
         return P.P_[x];
-      return 1.0;
+      if (P.p() == 0 or P.p() == 1)
+        return P.p() == 0 ? 1.0 : 0.0;
+      // sum up the tail that does not contain the mode, its terms decrease geometrically
+      const double eps{math::numeric_limits<double>::epsilon()};
+      const double p{P.p()}, q{1.0 - P.p()};
+      const int n{P.n()};
+      double sum{0};
+      if (x < static_cast<int>((n + 1.0) * p)) {
+        double term{pdf(x)};
+        for (int k{x}; k >= 0 and term > eps * sum; --k) {
+          sum += term;
+          term *= k * q / ((n - k + 1) * p);
+        }
+        return sum;
+      }
+      double term{pdf(x + 1)};
+      for (int k{x + 1}; k <= n and term > eps * sum; ++k) {
+        sum += term;
+        term *= (n - k) * p / ((k + 1) * q);
+      }
+      return 1.0 - sum;
     }
   };
 
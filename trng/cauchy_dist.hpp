@@ -141,6 +141,12 @@ namespace trng {
       cauchy_dist g(P);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      utility::generate_transformed<utility::u01_interval::oo, result_type>(
+          r, first, last, [this](result_type u) { return icdf_(u); });
+    }
     // property methods
     TRNG_CUDA_ENABLE
     result_type min() const { return -math::numeric_limits<result_type>::infinity(); }
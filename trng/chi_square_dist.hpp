@@ -39,6 +39,7 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/gamma_dist.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -55,6 +56,9 @@ namespace trng {
   public:
     using result_type = float_t;
 
+    // sampling methods, inversion of the cumulative density function is the default
+    enum class method_type { inversion, marsaglia_tsang };
+
     class param_type {
     private:
       int nu_{1};
@@ -110,6 +114,7 @@ namespace trng {
 
   private:
     param_type P;
+    method_type M{method_type::inversion};
 
     // inverse cumulative density function
     TRNG_CUDA_ENABLE
@@ -120,22 +125,40 @@ namespace trng {
   public:
     // constructor
     TRNG_CUDA_ENABLE
-    explicit chi_square_dist(int nu) : P{nu} {}
+    explicit chi_square_dist(int nu, method_type M = method_type::inversion) : P{nu}, M{M} {}
     TRNG_CUDA_ENABLE
-    explicit chi_square_dist(const param_type &P) : P{P} {}
+    explicit chi_square_dist(const param_type &P, method_type M = method_type::inversion)
+        : P{P}, M{M} {}
     // reset internal state
     TRNG_CUDA_ENABLE
     void reset() {}
     // random numbers
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
+      if (M == method_type::marsaglia_tsang) {
+        // chi-square distribution is a gamma distribution with kappa = nu / 2, theta = 2
+        gamma_dist<result_type> g(P.nu() / result_type(2), 2,
+                                  gamma_dist<result_type>::method_type::marsaglia_tsang);
+        return g(r);
+      }
       return icdf_(utility::uniformco<result_type>(r));
     }
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &P) {
-      chi_square_dist g(P);
+      chi_square_dist g(P, M);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      if (M == method_type::marsaglia_tsang) {
+        for (; first != last; ++first)
+          *first = (*this)(r);
+        return;
+      }
+      utility::generate_transformed<utility::u01_interval::co, result_type>(
+          r, first, last, [this](result_type u) { return icdf_(u); });
+    }
     // property methods
     TRNG_CUDA_ENABLE
     result_type min() const { return 0; }
@@ -146,6 +169,13 @@ namespace trng {
     TRNG_CUDA_ENABLE
     void param(const param_type &p_new) { P = p_new; }
     TRNG_CUDA_ENABLE
+    method_type method() const { return M; }
+    TRNG_CUDA_ENABLE
+    void method(method_type M_new) { M = M_new; }
+    // gamma variates of the Marsaglia-Tsang method consume a variable number of engine values
+    TRNG_CUDA_ENABLE
+    bool variable_draws() const { return M == method_type::marsaglia_tsang; }
+    TRNG_CUDA_ENABLE
     int nu() const { return P.nu(); }
     TRNG_CUDA_ENABLE
     void nu(int nu_new) { P.nu(nu_new); }
@@ -188,13 +218,13 @@ namespace trng {
   template<typename float_t>
   TRNG_CUDA_ENABLE inline bool operator==(const chi_square_dist<float_t> &g1,
                                           const chi_square_dist<float_t> &g2) {
-    return g1.param() == g2.param();
+    return g1.param() == g2.param() and g1.method() == g2.method();
   }
 
   template<typename float_t>
   TRNG_CUDA_ENABLE inline bool operator!=(const chi_square_dist<float_t> &g1,
                                           const chi_square_dist<float_t> &g2) {
-    return g1.param() != g2.param();
+    return not(g1 == g2);
   }
 
   // Streamable concept
@@ -203,7 +233,10 @@ namespace trng {
                                                    const chi_square_dist<float_t> &g) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    out << "[chi_square " << g.param() << ']';
+    out << "[chi_square " << g.param();
+    if (g.method() == chi_square_dist<float_t>::method_type::marsaglia_tsang)
+      out << " marsaglia_tsang";
+    out << ']';
     out.flags(flags);
     return out;
   }
@@ -211,13 +244,21 @@ namespace trng {
   template<typename char_t, typename traits_t, typename float_t>
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
                                                    chi_square_dist<float_t> &g) {
+    using method_type = typename chi_square_dist<float_t>::method_type;
     typename chi_square_dist<float_t>::param_type P;
+    method_type m{method_type::inversion};
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    in >> utility::ignore_spaces() >> utility::delim("[chi_square ") >> P >>
-        utility::delim(']');
-    if (in)
+    in >> utility::ignore_spaces() >> utility::delim("[chi_square ") >> P;
+    if (in and in.peek() == ' ') {
+      in >> utility::delim(" marsaglia_tsang");
+      m = method_type::marsaglia_tsang;
+    }
+    in >> utility::delim(']');
+    if (in) {
       g.param(P);
+      g.method(m);
+    }
     in.flags(flags);
     return in;
   }
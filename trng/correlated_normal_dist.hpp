@@ -176,6 +176,12 @@ namespace trng {
       correlated_normal_dist g(P);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      for (; first != last; ++first)
+        *first = (*this)(r);
+    }
     // property methods
     result_type min() const { return -math::numeric_limits<result_type>::infinity(); }
     result_type max() const { return math::numeric_limits<result_type>::infinity(); }
@@ -224,6 +224,15 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    template<typename iter>
+    TRNG_CUDA_ENABLE void generate(iter, iter);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
+    // random number that the (k + 1)-th call of operator() returns, state is not changed
+    TRNG_CUDA_ENABLE
+    result_type value_at(unsigned long long) const;
+    template<typename iter, typename out_iter>
+    TRNG_CUDA_ENABLE void values_at(iter, iter, out_iter) const;
 
   private:
     parameter_type P;
@@ -260,6 +269,45 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, count128_lcg_shift>(*this) * x);
   }
 
+  template<typename iter>
+  TRNG_CUDA_ENABLE inline void count128_lcg_shift::generate(iter first, iter last) {
+    const result_type a{P.a}, b{P.b};
+    const uint128 increment{P.increment};
+    uint128 r{S.r};
+    for (; first != last; ++first) {
+      r += increment;
+      result_type t{(r.lo() ^ r.hi()) * a + b};
+      t ^= (t >> 23u);
+      t ^= (t << 41u);
+      t ^= (t >> 18u);
+      *first = t;
+    }
+    S.r = r;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void count128_lcg_shift::generate(result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
+  TRNG_CUDA_ENABLE
+  inline count128_lcg_shift::result_type count128_lcg_shift::value_at(
+      unsigned long long k) const {
+    const uint128 r{S.r + uint128{0, k} * P.increment + P.increment};
+    result_type t{(r.lo() ^ r.hi()) * P.a + P.b};
+    t ^= (t >> 23u);
+    t ^= (t << 41u);
+    t ^= (t >> 18u);
+    return t;
+  }
+
+  template<typename iter, typename out_iter>
+  TRNG_CUDA_ENABLE inline void count128_lcg_shift::values_at(iter first, iter last,
+                                                             out_iter out) const {
+    for (; first != last; ++first, ++out)
+      *out = value_at(*first);
+  }
+
   // Parallel random number generator concept
 
   TRNG_CUDA_ENABLE
@@ -273,7 +321,7 @@ namespace trng {
       S.r += uint128{0, n} * P.increment;
       S.r += P.increment;
       P.increment *= uint128{0, s};
-      S.r -= P.increment;
+      backward();
     }
   }
 
@@ -292,6 +340,9 @@ namespace trng {
     jump(n);
   }
 
+  TRNG_CUDA_ENABLE
+  inline void count128_lcg_shift::backward() { S.r -= P.increment; }
+
 }  // namespace trng
 
 #endif
@@ -143,6 +143,12 @@ namespace trng {
       discrete_dist g(p);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      for (; first != last; ++first)
+        *first = (*this)(r);
+    }
     // property methods
     int min() const { return 0; }
     int max() const { return static_cast<int>(P.N_ - 1); }
@@ -129,6 +129,12 @@ namespace trng {
       exponential_dist g(P);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      utility::generate_transformed<utility::u01_interval::oc, result_type>(
+          r, first, last, [this](result_type u) { return -P.mu() * math::ln(u); });
+    }
     // property methods
     TRNG_CUDA_ENABLE
     result_type min() const { return 0; }
@@ -137,6 +137,16 @@ namespace trng {
       fast_discrete_dist g(P);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      utility::generate_transformed<utility::u01_interval::co, double>(
+          r, first, last, [this](double u) -> int {
+            const double U{u * P.N};
+            const int I{static_cast<int>(U)};
+            return U - I <= P.F[I] ? I : P.L[I];
+          });
+    }
     // property methods
     int min() const { return 0; }
     int max() const { return P.N - 1; }
@@ -39,6 +39,7 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/normal_dist.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -55,24 +56,41 @@ namespace trng {
   public:
     using result_type = float_t;
 
+    // sampling methods, inversion of the cumulative density function is the default
+    enum class method_type { inversion, marsaglia_tsang };
+
     class param_type {
     private:
       result_type kappa_{1}, theta_{1};
+      // constants of the Marsaglia-Tsang method
+      result_type d_, c_;
+
+      TRNG_CUDA_ENABLE
+      void calc_constants() {
+        // shape parameters less than one are boosted by one
+        d_ = (kappa_ < 1 ? kappa_ + 1 : kappa_) - result_type(1) / result_type(3);
+        c_ = 1 / math::sqrt(9 * d_);
+      }
 
     public:
       TRNG_CUDA_ENABLE
       result_type kappa() const { return kappa_; }
       TRNG_CUDA_ENABLE
-      void kappa(result_type kappa_new) { kappa_ = kappa_new; }
+      void kappa(result_type kappa_new) {
+        kappa_ = kappa_new;
+        calc_constants();
+      }
       TRNG_CUDA_ENABLE
       result_type theta() const { return theta_; }
       TRNG_CUDA_ENABLE
       void theta(result_type theta_new) { theta_ = theta_new; }
       TRNG_CUDA_ENABLE
-      param_type() = default;
+      param_type() { calc_constants(); }
       TRNG_CUDA_ENABLE
       explicit param_type(result_type kappa, result_type theta)
-          : kappa_(kappa), theta_(theta) {}
+          : kappa_(kappa), theta_(theta) {
+        calc_constants();
+      }
 
       friend class gamma_dist;
 
@@ -116,6 +134,33 @@ namespace trng {
 
   private:
     param_type P;
+    method_type M{method_type::inversion};
+
+    // G. Marsaglia and W. W. Tsang, ``A Simple Method for Generating Gamma Variables''
+    // ACM Transactions on Mathematical Software 26 (2000) 363--372
+    template<typename R>
+    TRNG_CUDA_ENABLE result_type marsaglia_tsang(R &r) const {
+      normal_dist<result_type> N(0, 1, normal_dist<result_type>::method_type::ziggurat);
+      result_type y;
+      while (true) {
+        const result_type x{N(r)};
+        result_type v{1 + P.c_ * x};
+        if (v <= 0)
+          continue;
+        v = v * v * v;
+        const result_type u{utility::uniformoo<result_type>(r)};
+        const result_type x2{x * x};
+        if (u < 1 - result_type(0.0331) * x2 * x2 or
+            math::ln(u) < x2 / 2 + P.d_ * (1 - v + math::ln(v))) {
+          y = P.d_ * v;
+          break;
+        }
+      }
+      // boost for shape parameters less than one
+      if (P.kappa() < 1)
+        y *= math::exp(math::ln(utility::uniformoo<result_type>(r)) / P.kappa());
+      return y * P.theta();
+    }
 
     // inverse cumulative density function
     TRNG_CUDA_ENABLE
@@ -126,22 +171,38 @@ namespace trng {
   public:
     // constructor
     TRNG_CUDA_ENABLE
-    explicit gamma_dist(result_type kappa, result_type theta) : P{kappa, theta} {}
+    explicit gamma_dist(result_type kappa, result_type theta,
+                        method_type M = method_type::inversion)
+        : P{kappa, theta}, M{M} {}
     TRNG_CUDA_ENABLE
-    explicit gamma_dist(const param_type &P) : P{P} {}
+    explicit gamma_dist(const param_type &P, method_type M = method_type::inversion)
+        : P{P}, M{M} {}
     // reset internal state
     TRNG_CUDA_ENABLE
     void reset() {}
     // random numbers
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
+      if (M == method_type::marsaglia_tsang)
+        return marsaglia_tsang(r);
       return icdf_(utility::uniformco<result_type>(r));
     }
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &p) {
-      gamma_dist g(p);
+      gamma_dist g(p, M);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      if (M == method_type::marsaglia_tsang) {
+        for (; first != last; ++first)
+          *first = (*this)(r);
+        return;
+      }
+      utility::generate_transformed<utility::u01_interval::co, result_type>(
+          r, first, last, [this](result_type u) { return icdf_(u); });
+    }
     // property methods
     TRNG_CUDA_ENABLE
     result_type min() const { return 0; }
@@ -152,6 +213,13 @@ namespace trng {
     TRNG_CUDA_ENABLE
     void param(const param_type &P_new) { P = P_new; }
     TRNG_CUDA_ENABLE
+    method_type method() const { return M; }
+    TRNG_CUDA_ENABLE
+    void method(method_type M_new) { M = M_new; }
+    // rejections of the Marsaglia-Tsang method consume additional engine values
+    TRNG_CUDA_ENABLE
+    bool variable_draws() const { return M == method_type::marsaglia_tsang; }
+    TRNG_CUDA_ENABLE
     result_type kappa() const { return P.kappa(); }
     TRNG_CUDA_ENABLE
     void kappa(result_type kappa_new) { P.kappa(kappa_new); }
@@ -198,13 +266,13 @@ namespace trng {
   template<typename float_t>
   TRNG_CUDA_ENABLE inline bool operator==(const gamma_dist<float_t> &g1,
                                           const gamma_dist<float_t> &g2) {
-    return g1.param() == g2.param();
+    return g1.param() == g2.param() and g1.method() == g2.method();
   }
 
   template<typename float_t>
   TRNG_CUDA_ENABLE inline bool operator!=(const gamma_dist<float_t> &g1,
                                           const gamma_dist<float_t> &g2) {
-    return g1.param() != g2.param();
+    return not(g1 == g2);
   }
 
   // Streamable concept
@@ -213,7 +281,10 @@ namespace trng {
                                                    const gamma_dist<float_t> &g) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    out << "[gamma " << g.param() << ']';
+    out << "[gamma " << g.param();
+    if (g.method() == gamma_dist<float_t>::method_type::marsaglia_tsang)
+      out << " marsaglia_tsang";
+    out << ']';
     out.flags(flags);
     return out;
   }
@@ -221,12 +292,21 @@ namespace trng {
   template<typename char_t, typename traits_t, typename float_t>
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
                                                    gamma_dist<float_t> &g) {
+    using method_type = typename gamma_dist<float_t>::method_type;
     typename gamma_dist<float_t>::param_type P;
+    method_type m{method_type::inversion};
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    in >> utility::ignore_spaces() >> utility::delim("[gamma ") >> P >> utility::delim(']');
-    if (in)
+    in >> utility::ignore_spaces() >> utility::delim("[gamma ") >> P;
+    if (in and in.peek() == ' ') {
+      in >> utility::delim(" marsaglia_tsang");
+      m = method_type::marsaglia_tsang;
+    }
+    in >> utility::delim(']');
+    if (in) {
       g.param(P);
+      g.method(m);
+    }
     in.flags(flags);
     return in;
   }
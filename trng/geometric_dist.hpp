@@ -99,6 +99,14 @@ namespace trng {
       geometric_dist g(p);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      utility::generate_transformed<utility::u01_interval::oo, double>(
+          r, first, last, [this](double u) {
+            return static_cast<int>(math::ln(u) * P.one_over_ln_q());
+          });
+    }
     // property methods
     TRNG_CUDA_ENABLE
     int min() const { return 0; }
@@ -0,0 +1,283 @@
+// Copyright (c) 2000-2026, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_GF2_POLYNOMIAL_HPP)
+
+#define TRNG_GF2_POLYNOMIAL_HPP
+
+#include <trng/int_types.hpp>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <initializer_list>
+#if defined _MSC_VER && __cplusplus <= 201703
+#include <ciso646>
+#endif
+
+namespace trng {
+
+  // Polynomials over GF(2) with bit-packed coefficients.  They serve to jump ahead generators
+  // whose state transition is linear over GF(2).  If f is the characteristic polynomial of the
+  // transition matrix T, then T^s equals h(T) with h(x) = x^s mod f(x).  Thus, jumping ahead
+  // by s steps reduces to deg f steps of the generator, see
+  //
+  // H. Haramoto, M. Matsumoto, T. Nishimura, F. Panneton, and P. L'Ecuyer,
+  //   ``Efficient jump ahead for F_2-linear random number generators''
+  //   INFORMS Journal on Computing 20 (2008) 385--390.
+  class gf2_polynomial {
+  public:
+    using word_type = uint64_t;
+
+  private:
+    static constexpr int word_bits{64};
+    // bit i of c[k] is the coefficient of x^(64 k + i), the most significant word is not zero
+    std::vector<word_type> c;
+
+    static int words(int bits) { return (bits + word_bits - 1) / word_bits; }
+
+    void normalize() {
+      while (not c.empty() and c.back() == 0)
+        c.pop_back();
+    }
+
+    // bits lo, ..., lo + width - 1 of v with 0 < width <= 64
+    static word_type get_bits(const std::vector<word_type> &v, int lo, int width) {
+      const int k{lo / word_bits}, s{lo % word_bits};
+      word_type r{v[k] >> s};
+      if (s + width > word_bits)
+        r |= v[k + 1] << (word_bits - s);
+      return width < word_bits ? r & ((word_type(1) << width) - 1) : r;
+    }
+
+    // add bits b of width 0 < width <= 64 at position pos to v
+    static void xor_bits(std::vector<word_type> &v, int pos, word_type b, int width) {
+      const int k{pos / word_bits}, s{pos % word_bits};
+      v[k] ^= b << s;
+      if (s + width > word_bits)
+        v[k + 1] ^= b >> (word_bits - s);
+    }
+
+    static word_type parity(word_type x) {
+      x ^= x >> 32u;
+      x ^= x >> 16u;
+      x ^= x >> 8u;
+      x ^= x >> 4u;
+      x ^= x >> 2u;
+      x ^= x >> 1u;
+      return x & 1u;
+    }
+
+    // reduction modulo a fixed polynomial f, which is assumed to be sparse
+    class modulus {
+      int p;                  // degree of f
+      std::vector<int> e;     // exponents of all non-leading terms of f
+      int w;                  // number of coefficients that are reduced at once
+
+    public:
+      explicit modulus(const gf2_polynomial &f) : p{f.degree()}, w{word_bits} {
+        for (int i{0}; i < p; ++i)
+          if (f.coefficient(i))
+            e.push_back(i);
+        if (not e.empty())
+          w = std::min(w, p - e.back());
+      }
+
+      void reduce(gf2_polynomial &h) const {
+        std::vector<word_type> &v(h.c);
+        // terms of degree hi - w + 1 to hi do not alias the terms they are reduced to
+        for (int hi{static_cast<int>(v.size()) * word_bits - 1}; hi >= p;) {
+          const int lo{std::max(p, hi - w + 1)}, width{hi - lo + 1};
+          const word_type b{get_bits(v, lo, width)};
+          if (b != 0) {
+            xor_bits(v, lo, b, width);
+            for (int i : e)
+              xor_bits(v, lo - p + i, b, width);
+          }
+          hi = lo - 1;
+        }
+        if (static_cast<int>(v.size()) > words(p))
+          v.resize(words(p));
+        h.normalize();
+      }
+
+      void square(gf2_polynomial &h) const {
+        std::vector<word_type> v(2 * h.c.size(), 0);
+        for (std::size_t k{0}; k < h.c.size(); ++k)
+          for (int i{0}; i < word_bits; ++i)
+            if ((h.c[k] >> i) & 1u)
+              v[2 * k + (2 * i) / word_bits] |= word_type(1) << ((2 * i) % word_bits);
+        h.c.swap(v);
+        reduce(h);
+      }
+
+      void mult_x(gf2_polynomial &h) const {
+        h.c.push_back(0);
+        for (std::size_t k{h.c.size() - 1}; k > 0; --k)
+          h.c[k] = (h.c[k] << 1u) | (h.c[k - 1] >> (word_bits - 1));
+        h.c[0] <<= 1u;
+        reduce(h);
+      }
+    };
+
+  public:
+    // zero polynomial
+    gf2_polynomial() = default;
+
+    // polynomial with the given non-zero coefficients
+    explicit gf2_polynomial(std::initializer_list<int> exponents) {
+      for (int i : exponents) {
+        if (static_cast<int>(c.size()) < words(i + 1))
+          c.resize(words(i + 1), 0);
+        c[i / word_bits] ^= word_type(1) << (i % word_bits);
+      }
+      normalize();
+    }
+
+    // degree, -1 for the zero polynomial
+    int degree() const {
+      if (c.empty())
+        return -1;
+      int d{static_cast<int>(c.size()) * word_bits - 1};
+      while (((c.back() >> (d % word_bits)) & 1u) == 0)
+        --d;
+      return d;
+    }
+
+    bool coefficient(int i) const {
+      return i >= 0 and i / word_bits < static_cast<int>(c.size()) and
+             ((c[i / word_bits] >> (i % word_bits)) & 1u) == 1;
+    }
+
+    friend bool operator==(const gf2_polynomial &a, const gf2_polynomial &b) {
+      return a.c == b.c;
+    }
+    friend bool operator!=(const gf2_polynomial &a, const gf2_polynomial &b) {
+      return a.c != b.c;
+    }
+
+    // Minimal polynomial f of degree L of the bit sequence s_0, s_1, ..., s_{n - 1}, i.e.,
+    // s_{k + L} = f_{L - 1} s_{k + L - 1} + ... + f_0 s_k, via the Berlekamp-Massey
+    // algorithm.  The result is unique if n >= 2 L.
+    static gf2_polynomial minimal_polynomial(const std::vector<bool> &s) {
+      const int n{static_cast<int>(s.size())};
+      // sequence in reverse order such that s_i, s_{i - 1}, ... are consecutive bits
+      std::vector<word_type> r(words(n) + 2, 0);
+      for (int k{0}; k < n; ++k)
+        if (s[n - 1 - k])
+          r[k / word_bits] |= word_type(1) << (k % word_bits);
+      // connection polynomials C and B
+      std::vector<word_type> C(words(n + 1) + 1, 0), B(C), T;
+      C[0] = B[0] = 1;
+      int L{0}, m{1};
+      auto add_shifted = [](std::vector<word_type> &X, const std::vector<word_type> &Y,
+                            int shift) {
+        const int ws{shift / word_bits}, bs{shift % word_bits};
+        const int size{static_cast<int>(X.size())};
+        for (int k{0}; k + ws < size; ++k) {
+          X[k + ws] ^= Y[k] << bs;
+          if (bs > 0 and k + ws + 1 < size)
+            X[k + ws + 1] ^= Y[k] >> (word_bits - bs);
+        }
+      };
+      for (int i{0}; i < n; ++i) {
+        // discrepancy s_i + C_1 s_{i - 1} + ... + C_L s_{i - L}
+        word_type d{0};
+        for (int k{0}, k_end{L / word_bits + 1}; k < k_end; ++k)
+          d ^= get_bits(r, n - 1 - i + k * word_bits, word_bits) & C[k];
+        if (parity(d) == 0) {
+          ++m;
+        } else if (2 * L <= i) {
+          T = C;
+          add_shifted(C, B, m);
+          L = i + 1 - L;
+          B.swap(T);
+          m = 1;
+        } else {
+          add_shifted(C, B, m);
+          ++m;
+        }
+      }
+      // characteristic polynomial is the reciprocal of the connection polynomial
+      gf2_polynomial f;
+      f.c.resize(words(L + 1), 0);
+      for (int i{0}; i <= L; ++i)
+        if ((C[i / word_bits] >> (i % word_bits)) & 1u)
+          f.c[(L - i) / word_bits] |= word_type(1) << ((L - i) % word_bits);
+      f.normalize();
+      return f;
+    }
+
+    // x^e mod f
+    friend gf2_polynomial power_x_mod(unsigned long long e, const gf2_polynomial &f) {
+      const modulus F(f);
+      gf2_polynomial h{0};
+      F.reduce(h);
+      int i{63};
+      while (i >= 0 and ((e >> i) & 1u) == 0)
+        --i;
+      for (; i >= 0; --i) {
+        F.square(h);
+        if ((e >> i) & 1u)
+          F.mult_x(h);
+      }
+      return h;
+    }
+
+    // x^(2^k) mod f
+    friend gf2_polynomial power2_x_mod(unsigned long long k, const gf2_polynomial &f) {
+      const modulus F(f);
+      gf2_polynomial h{1};
+      F.reduce(h);
+      for (unsigned long long i{0}; i < k; ++i)
+        F.square(h);
+      return h;
+    }
+
+    // h / x mod f, requires f_0 = 1 and deg h < deg f
+    friend gf2_polynomial div_x_mod(gf2_polynomial h, const gf2_polynomial &f) {
+      if (h.coefficient(0)) {
+        // h + f is divisible by x
+        if (h.c.size() < f.c.size())
+          h.c.resize(f.c.size(), 0);
+        for (std::size_t k{0}; k < f.c.size(); ++k)
+          h.c[k] ^= f.c[k];
+      }
+      for (std::size_t k{0}; k < h.c.size(); ++k)
+        h.c[k] = (h.c[k] >> 1u) | (k + 1 < h.c.size() ? h.c[k + 1] << (word_bits - 1) : 0);
+      h.normalize();
+      return h;
+    }
+  };
+
+}  // namespace trng
+
+#endif
@@ -118,6 +118,14 @@ namespace trng {
       hypergeometric_dist g(P);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      utility::generate_transformed<utility::u01_interval::oo, double>(
+          r, first, last, [this](double u) {
+            return P.x_min + static_cast<int>(utility::discrete(u, P.P_.begin(), P.P_.end()));
+          });
+    }
     // property methods
     int min() const { return P.x_min; }
     int max() const { return P.x_max; }
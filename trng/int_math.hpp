@@ -42,6 +42,7 @@
 #include <cassert>
 #include <algorithm>
 #include <stdexcept>
+#include <type_traits>
 #if defined _MSC_VER && __cplusplus <= 201703
 #include <ciso646>
 #endif
@@ -82,35 +83,169 @@ namespace trng {
 
     // ---------------------------------------------------------------
 
+    // Barrett reduction of x modulo m for 0 <= x < 2^(2 b), where b is the number of bits of
+    // 0 < m < 2^31, see algorithm 14.42 in
+    //
+    // A. J. Menezes, P. C. van Oorschot, and S. A. Vanstone, ``Handbook of Applied
+    //   Cryptography'', CRC Press, 1996.
+    //
+    // It replaces divisions by a modulus that is not known at compile time by two
+    // multiplications.  The products of two residues are always in the admissible range.
+    class barrett {
+      uint64_t m;
+      unsigned int b;
+      uint64_t mu;
+      uint64_t mu64;
+
+    public:
+      TRNG_CUDA_ENABLE
+      explicit barrett(int32_t m)
+          : m(static_cast<uint64_t>(m)),
+            b(log2_floor(static_cast<uint32_t>(m)) + 1u),
+            mu(0),
+            mu64(~static_cast<uint64_t>(0) / static_cast<uint64_t>(m)) {
+        mu = (static_cast<uint64_t>(1) << (2u * b)) / this->m;
+      }
+
+      TRNG_CUDA_ENABLE
+      int32_t modulus() const { return static_cast<int32_t>(m); }
+
+      TRNG_CUDA_ENABLE
+      int32_t modulo(uint64_t x) const {
+        // q underestimates x / m by at most 2
+        const uint64_t q{((x >> (b - 1)) * mu) >> (b + 1)};
+        x -= q * m;
+        // branch-free corrections, the outcome of the comparisons is not predictable
+        x -= m & (static_cast<uint64_t>(0) - static_cast<uint64_t>(x >= m));
+        x -= m & (static_cast<uint64_t>(0) - static_cast<uint64_t>(x >= m));
+        return static_cast<int32_t>(x);
+      }
+
+      // x mod m for all 0 <= x < 2^64, slower than modulo
+      TRNG_CUDA_ENABLE
+      int32_t reduce(uint64_t x) const {
+        // q is the upper half of the 128-bit product x * mu64 and underestimates x / m by at
+        // most 2
+        const uint64_t x0{x & 0xffffffffu}, x1{x >> 32u};
+        const uint64_t u0{mu64 & 0xffffffffu}, u1{mu64 >> 32u};
+        const uint64_t t{x1 * u0 + ((x0 * u0) >> 32u)};
+        const uint64_t w{(t & 0xffffffffu) + x0 * u1};
+        const uint64_t q{x1 * u1 + (t >> 32u) + (w >> 32u)};
+        x -= q * m;
+        x -= m & (static_cast<uint64_t>(0) - static_cast<uint64_t>(x >= m));
+        x -= m & (static_cast<uint64_t>(0) - static_cast<uint64_t>(x >= m));
+        return static_cast<int32_t>(x);
+      }
+
+      // a * b mod m for 0 <= a, b < m
+      TRNG_CUDA_ENABLE
+      int32_t mult(int32_t a, int32_t b) const {
+        return modulo(static_cast<uint64_t>(a) * static_cast<uint64_t>(b));
+      }
+    };
+
+    // modulus that is known at run time only, reduced by the remainder operator
+    class dynamic_modulus {
+      int32_t m;
+
+    public:
+      TRNG_CUDA_ENABLE
+      explicit dynamic_modulus(int32_t m) : m(m) {}
+
+      TRNG_CUDA_ENABLE
+      int32_t modulus() const { return m; }
+
+      // a * b mod m for 0 <= a, b < m
+      TRNG_CUDA_ENABLE
+      int32_t mult(int32_t a, int32_t b) const {
+        return static_cast<int32_t>((static_cast<int64_t>(a) * static_cast<int64_t>(b)) % m);
+      }
+
+      // x mod m for all 0 <= x < 2^64
+      TRNG_CUDA_ENABLE
+      int32_t reduce(uint64_t x) const {
+        return static_cast<int32_t>(x % static_cast<uint64_t>(m));
+      }
+    };
+
+    // 64-bit divisions are expensive on GPUs, Barrett reduction is used for moduli that are
+    // known at run time in device code only
+#if defined TRNG_CUDA
+    using runtime_modulus = barrett;
+#else
+    using runtime_modulus = dynamic_modulus;
+#endif
+
+    // ---------------------------------------------------------------
+
+    // The following functions take the modulus either as an integer, which is reduced by
+    // runtime_modulus, or as an object that provides the methods modulus(), mult(a, b) and
+    // reduce(x), e.g., barrett, dynamic_modulus or static_modulus.
+    //
+    // Matrix products accumulate the products of residues, each less than 2^62, in unsigned
+    // 64-bit integers and reduce each sum only once.  An accumulator is lowered by a multiple of
+    // m when its most significant bit is set, which keeps it free of overflow for any n.  The
+    // inner loops have no data-dependent branches and run over contiguous memory, compilers
+    // vectorize them.
+
+    // largest multiple of m not greater than 2^63
+    TRNG_CUDA_ENABLE
+    inline uint64_t accumulator_bound(int32_t m) {
+      return ((static_cast<uint64_t>(1) << 63u) / static_cast<uint64_t>(m)) *
+             static_cast<uint64_t>(m);
+    }
+
+    TRNG_CUDA_ENABLE
+    inline void accumulate(uint64_t &t, int32_t a, int32_t b, uint64_t bound) {
+      t += static_cast<uint64_t>(a) * static_cast<uint64_t>(b);
+      t -= bound & (static_cast<uint64_t>(0) - (t >> 63u));
+    }
+
+    template<int n, typename modulus_type,
+             typename = typename std::enable_if<std::is_class<modulus_type>::value>::type>
+    TRNG_CUDA_ENABLE void matrix_vec_mult(const int32_t (&a)[n * n], const int32_t (&b)[n],
+                                          int32_t (&c)[n], modulus_type M) {
+      const uint64_t bound{accumulator_bound(M.modulus())};
+      uint64_t t[n];
+      for (int j{0}; j < n; ++j)
+        t[j] = 0;
+      for (int k{0}; k < n; ++k)
+        for (int j{0}; j < n; ++j)
+          accumulate(t[j], a[j * n + k], b[k], bound);
+      for (int j{0}; j < n; ++j)
+        c[j] = M.reduce(t[j]);
+    }
+
     template<int n>
     TRNG_CUDA_ENABLE void matrix_vec_mult(const int32_t (&a)[n * n], const int32_t (&b)[n],
                                           int32_t (&c)[n], int32_t m) {
-      for (int j{0}; j < n; ++j) {
-        int64_t t{0};
-        for (int k{0}; k < n; ++k) {
-          t += (static_cast<int64_t>(a[j * n + k]) * static_cast<int64_t>(b[k])) % m;
-          if (t >= m)
-            t -= m;
-        }
-        c[j] = static_cast<int32_t>(t);
-      }
+      matrix_vec_mult<n>(a, b, c, runtime_modulus(m));
     }
 
     //------------------------------------------------------------------
 
+    template<int n, typename modulus_type,
+             typename = typename std::enable_if<std::is_class<modulus_type>::value>::type>
+    TRNG_CUDA_ENABLE void matrix_mult(const int32_t (&a)[n * n], const int32_t (&b)[n * n],
+                                      int32_t (&c)[n * n], modulus_type M) {
+      const uint64_t bound{accumulator_bound(M.modulus())};
+      uint64_t t[n];
+      for (int j{0}; j < n; ++j) {
+        // row j of c is a linear combination of the rows of b
+        for (int i{0}; i < n; ++i)
+          t[i] = 0;
+        for (int k{0}; k < n; ++k)
+          for (int i{0}; i < n; ++i)
+            accumulate(t[i], a[j * n + k], b[k * n + i], bound);
+        for (int i{0}; i < n; ++i)
+          c[j * n + i] = M.reduce(t[i]);
+      }
+    }
+
     template<int n>
     TRNG_CUDA_ENABLE void matrix_mult(const int32_t (&a)[n * n], const int32_t (&b)[n * n],
                                       int32_t (&c)[n * n], int32_t m) {
-      for (int i{0}; i < n; ++i)
-        for (int j{0}; j < n; ++j) {
-          int64_t t{0};
-          for (int k{0}; k < n; ++k) {
-            t += (static_cast<int64_t>(a[j * n + k]) * static_cast<int64_t>(b[k * n + i])) % m;
-            if (t >= m)
-              t -= m;
-          }
-          c[j * n + i] = static_cast<int32_t>(t);
-        }
+      matrix_mult<n>(a, b, c, runtime_modulus(m));
     }
 
     // ---------------------------------------------------------------
@@ -141,8 +276,10 @@ namespace trng {
 
     //------------------------------------------------------------------
 
-    template<int n>
-    TRNG_CUDA_ENABLE void gauss(int32_t (&a)[n * n], int32_t (&b)[n], int32_t m) {
+    template<int n, typename modulus_type,
+             typename = typename std::enable_if<std::is_class<modulus_type>::value>::type>
+    TRNG_CUDA_ENABLE void gauss(int32_t (&a)[n * n], int32_t (&b)[n], modulus_type M) {
+      const int32_t m{M.modulus()};
       // initialize indices
       int rank{0};
       int32_t p[n];
@@ -168,22 +305,18 @@ namespace trng {
         ++rank;
         int32_t t{modulo_inverse(a[n * p[i] + i], m)};
         for (int j{i}; j < n; ++j)
-          a[n * p[i] + j] = static_cast<int32_t>(
-              (static_cast<int64_t>(a[n * p[i] + j]) * static_cast<int64_t>(t)) % m);
-        b[p[i]] =
-            static_cast<int32_t>((static_cast<int64_t>(b[p[i]]) * static_cast<int64_t>(t)) % m);
+          a[n * p[i] + j] = M.mult(a[n * p[i] + j], t);
+        b[p[i]] = M.mult(b[p[i]], t);
         for (int j{i + 1}; j < n; ++j) {
           if (a[n * p[j] + i] != 0) {
             t = modulo_inverse(a[n * p[j] + i], m);
             for (int k{i}; k < n; ++k) {
-              a[n * p[j] + k] = static_cast<int32_t>(
-                  (static_cast<int64_t>(a[n * p[j] + k]) * static_cast<int64_t>(t)) % m);
+              a[n * p[j] + k] = M.mult(a[n * p[j] + k], t);
               a[n * p[j] + k] -= a[n * p[i] + k];
               if (a[n * p[j] + k] < 0)
                 a[n * p[j] + k] += m;
             }
-            b[p[j]] = static_cast<int32_t>(
-                (static_cast<int64_t>(b[p[j]]) * static_cast<int64_t>(t)) % m);
+            b[p[j]] = M.mult(b[p[j]], t);
             b[p[j]] -= b[p[i]];
             if (b[p[j]] < 0)
               b[p[j]] += m;
@@ -200,8 +333,7 @@ namespace trng {
       // solve triangular system
       for (int i{n - 2}; i >= 0; --i)
         for (int j{i + 1}; j < n; ++j) {
-          b[p[i]] -= static_cast<int32_t>(
-              (static_cast<int64_t>(a[n * p[i] + j]) * static_cast<int64_t>(b[p[j]])) % m);
+          b[p[i]] -= M.mult(a[n * p[i] + j], b[p[j]]);
           if (b[p[i]] < 0)
             b[p[i]] += m;
         }
@@ -212,6 +344,11 @@ namespace trng {
         b[i] = p[i];
     }
 
+    template<int n>
+    TRNG_CUDA_ENABLE void gauss(int32_t (&a)[n * n], int32_t (&b)[n], int32_t m) {
+      gauss<n>(a, b, runtime_modulus(m));
+    }
+
     //------------------------------------------------------------------
 
 #if _MSC_VER
@@ -321,33 +458,79 @@ namespace trng {
       return modulo_helper<m, log2_floor(r)>::modulo(x);
     }
 
+    // modulus that is known at compile time, compilers replace the division by a
+    // multiplication with a precomputed reciprocal, i.e., Barrett reduction with constants
+    template<int32_t m>
+    class static_modulus {
+    public:
+      TRNG_CUDA_ENABLE
+      constexpr int32_t modulus() const { return m; }
+
+      // a * b mod m for 0 <= a, b < m
+      TRNG_CUDA_ENABLE
+      int32_t mult(int32_t a, int32_t b) const {
+        return static_cast<int32_t>((static_cast<int64_t>(a) * static_cast<int64_t>(b)) % m);
+      }
+
+      // x mod m for all 0 <= x < 2^64
+      TRNG_CUDA_ENABLE
+      int32_t reduce(uint64_t x) const {
+        return static_cast<int32_t>(x % static_cast<uint64_t>(m));
+      }
+    };
+
+    template<int n, int32_t m>
+    TRNG_CUDA_ENABLE void matrix_vec_mult(const int32_t (&a)[n * n], const int32_t (&b)[n],
+                                          int32_t (&c)[n]) {
+      matrix_vec_mult<n>(a, b, c, static_modulus<m>());
+    }
+
+    template<int n, int32_t m>
+    TRNG_CUDA_ENABLE void matrix_mult(const int32_t (&a)[n * n], const int32_t (&b)[n * n],
+                                      int32_t (&c)[n * n]) {
+      matrix_mult<n>(a, b, c, static_modulus<m>());
+    }
+
+    template<int n, int32_t m>
+    TRNG_CUDA_ENABLE void gauss(int32_t (&a)[n * n], int32_t (&b)[n]) {
+      gauss<n>(a, b, static_modulus<m>());
+    }
+
     //------------------------------------------------------------------
 
+    // b^n mod m by binary exponentiation
+    template<int32_t m>
+    inline int32_t power_mod(int32_t b, int32_t n) {
+      int64_t p{1}, t{b};
+      while (n > 0) {
+        if ((n & 0x1) == 0x1)
+          p = modulo<m, 1>(p * t);
+        t = modulo<m, 1>(t * t);
+        n /= 2;
+      }
+      return static_cast<int32_t>(p);
+    }
+
+    // The classes power_table_2x16, power_table_3x11 and power_window compute b^n mod m for
+    // 0 <= n < 2^31.  They differ in their memory footprint and hence in their performance
+    // under cache pressure.  int_math::power refers to one of them, selected at compile time
+    // by the macro TRNG_POWER_BACKEND (see below).
+
+    // two tables with 2^16 and 2^15 entries (384 KB), one modular multiplication per call
     template<int32_t m, int32_t b>
-    class power {
+    class power_table_2x16 {
       uint32_t b_power0[0x10000], b_power1[0x08000];
 
-      int32_t pow(int32_t n) {
-        int64_t p{1}, t{b};
-        while (n > 0) {
-          if ((n & 0x1) == 0x1)
-            p = modulo<m, 1>(p * t);
-          t = modulo<m, 1>(t * t);
-          n /= 2;
-        }
-        return static_cast<int32_t>(p);
-      }
-
     public:
       // make it non-copyable
-      power &operator=(const power &) = delete;
-      power(const power &) = delete;
+      power_table_2x16 &operator=(const power_table_2x16 &) = delete;
+      power_table_2x16(const power_table_2x16 &) = delete;
 
-      power() {
+      power_table_2x16() {
         for (int32_t i{0}; i < 0x10000; ++i)
-          b_power0[i] = pow(i);
+          b_power0[i] = power_mod<m>(b, i);
         for (int32_t i{0}; i < 0x08000; ++i)
-          b_power1[i] = pow(i * 0x10000);
+          b_power1[i] = power_mod<m>(b, i * 0x10000);
       }
       int32_t operator()(int32_t n) const {
         return modulo<m, 1>(static_cast<uint64_t>(b_power1[n >> 16]) *
@@ -355,6 +538,98 @@ namespace trng {
       }
     };
 
+    // three tables with 2^11, 2^11 and 2^9 entries (18 KB), two modular multiplications per
+    // call
+    template<int32_t m, int32_t b>
+    class power_table_3x11 {
+      uint32_t b_power0[0x800], b_power1[0x800], b_power2[0x200];
+
+    public:
+      // make it non-copyable
+      power_table_3x11 &operator=(const power_table_3x11 &) = delete;
+      power_table_3x11(const power_table_3x11 &) = delete;
+
+      power_table_3x11() {
+        for (int32_t i{0}; i < 0x800; ++i) {
+          b_power0[i] = power_mod<m>(b, i);
+          b_power1[i] = power_mod<m>(b, i * 0x800);
+        }
+        for (int32_t i{0}; i < 0x200; ++i)
+          b_power2[i] = power_mod<m>(b, i * 0x400000);
+      }
+      int32_t operator()(int32_t n) const {
+        const int32_t p{modulo<m, 1>(static_cast<uint64_t>(b_power2[n >> 22]) *
+                                     static_cast<uint64_t>(b_power1[(n >> 11) & 0x7ff]))};
+        return modulo<m, 1>(static_cast<uint64_t>(p) *
+                            static_cast<uint64_t>(b_power0[n & 0x7ff]));
+      }
+    };
+
+    // left-to-right exponentiation with a fixed window of four bits, the 16 powers b^0, ...,
+    // b^15 (64 bytes) fit into a single cache line, 35 modular multiplications per call
+    template<int32_t m, int32_t b>
+    class power_window {
+      uint32_t b_power[0x10];
+
+    public:
+      // make it non-copyable
+      power_window &operator=(const power_window &) = delete;
+      power_window(const power_window &) = delete;
+
+      power_window() {
+        for (int32_t i{0}; i < 0x10; ++i)
+          b_power[i] = power_mod<m>(b, i);
+      }
+      int32_t operator()(int32_t n) const {
+        uint64_t p{b_power[(n >> 28) & 0xf]};
+        for (int shift{24}; shift >= 0; shift -= 4) {
+          p = modulo<m, 1>(p * p);
+          p = modulo<m, 1>(p * p);
+          p = modulo<m, 1>(p * p);
+          p = modulo<m, 1>(p * p);
+          p = modulo<m, 1>(p * b_power[(n >> shift) & 0xf]);
+        }
+        return static_cast<int32_t>(p);
+      }
+    };
+
+#define TRNG_POWER_TABLE_2X16 1
+#define TRNG_POWER_TABLE_3X11 2
+#define TRNG_POWER_WINDOW 3
+
+#if !(defined TRNG_POWER_BACKEND)
+#define TRNG_POWER_BACKEND TRNG_POWER_TABLE_2X16
+#endif
+
+    // The back-end must be the same for the library and for all code using it.  When
+    // building with CMake, set the cache variable TRNG_POWER_BACKEND.
+#if TRNG_POWER_BACKEND == TRNG_POWER_TABLE_2X16
+    template<int32_t m, int32_t b>
+    using power = power_table_2x16<m, b>;
+#elif TRNG_POWER_BACKEND == TRNG_POWER_TABLE_3X11
+    template<int32_t m, int32_t b>
+    using power = power_table_3x11<m, b>;
+#elif TRNG_POWER_BACKEND == TRNG_POWER_WINDOW
+    template<int32_t m, int32_t b>
+    using power = power_window<m, b>;
+#else
+#error "unknown value of TRNG_POWER_BACKEND"
+#endif
+
+    // Wrapper that builds the table of the selected back-end of power on first use.  The
+    // initialization of function-local statics is thread-safe.  Thus, processes that never
+    // use a yarn engine do not pay for building tables, e.g., at library load time.
+    template<int32_t m, int32_t b>
+    class power_lazy {
+    public:
+      constexpr power_lazy() {}
+      int32_t operator()(int32_t n) const { return table()(n); }
+      static const power<m, b> &table() {
+        static const power<m, b> t;
+        return t;
+      }
+    };
+
   }  // namespace int_math
 
 }  // namespace trng
@@ -38,12 +38,14 @@
 #include <trng/utility.hpp>
 #include <trng/minstd.hpp>
 #include <trng/int_types.hpp>
-#include <trng/linear_algebra.hpp>
+#include <trng/int_math.hpp>
+#include <trng/lagfib_polynomial.hpp>
 #include <climits>
 #include <stdexcept>
 #include <ostream>
 #include <istream>
 #include <sstream>
+#include <vector>
 #if defined _MSC_VER && __cplusplus <= 201703
 #include <ciso646>
 #endif
@@ -151,33 +153,33 @@ namespace trng {
       S.index = B - 1;
     }
 
-    void discard(unsigned long long n) {
-      const unsigned int matrix_size = B;
-      using matrix_type = matrix<result_type, matrix_size>;
-      using vector_type = vector<result_type, matrix_size>;
-      using size_type = typename matrix_type::size_type;
-      const unsigned long long n_pivot{int_math::log2_ceil(n) * B * B * B};
-      constexpr auto mask = int_math::mask(B);
-      if (n > n_pivot) {
-        const unsigned long long n_partial{n - matrix_size};
-        matrix_type M;
-        for (size_type i{0}; i < matrix_size - 1; ++i)
-          M(i, i + 1) = 1;
-        M(matrix_size - 1, matrix_size - B) = 1;
-        M(matrix_size - 1, matrix_size - A) = 1;
-        M = power(M, n_partial);
-        vector_type V;
-        for (size_type i{0}; i < matrix_size; ++i)
-          V(matrix_size - 1 - i) = S.r[(S.index - i) & mask];
-        V = M * V;
-        S.index = static_cast<unsigned int>(S.index + n_partial);
-        S.index &= mask;
-        for (size_type i{0}; i < matrix_size; ++i)
-          S.r[(S.index - i) & mask] = V(matrix_size - 1 - i);
-        n -= n_partial;
+    void discard(unsigned long long n) { jump(n); }
+
+    // Parallel random number generator concept, jump ahead via the characteristic polynomial
+    // of the recurrence, there is no leapfrog splitting
+    void jump2(unsigned int s) {
+      if (s < 64u) {
+        jump(1ull << s);
+      } else {
+        polynomial_type h({A, B});
+        h.power2_x(s);
+        for (unsigned int i{0}; i < B; ++i)
+          h.div_x();
+        // 2^s is divisible by the size of the status buffer
+        jump(h, 0ull - B);
+      }
+    }
+
+    void jump(unsigned long long s) {
+      const unsigned long long s_pivot{(int_math::log2_ceil(s) + 1) * B * B / 2};
+      if (s > s_pivot) {
+        polynomial_type h({A, B});
+        h.power_x(s - B);
+        jump(h, s - B);
+      } else {
+        for (unsigned long long i{0}; i < s; ++i)
+          step();
       }
-      for (unsigned long long i{0}; i < n; ++i)
-        step();
     }
 
     // Equality comparable concept
@@ -232,6 +234,19 @@ namespace trng {
     long operator()(long x) {
       return static_cast<long>(utility::uniformco<double, lagfib2plus>(*this) * x);
     }
+    template<typename iter>
+    void generate(iter first, iter last) {
+      constexpr auto mask_B{int_math::mask(static_cast<decltype(S.index)>(B))};
+      unsigned int index{S.index};
+      for (; first != last; ++first) {
+        ++index;
+        index &= mask_B;
+        S.r[index] = S.r[(index - A) & mask_B] + S.r[(index - B) & mask_B];
+        *first = S.r[index];
+      }
+      S.index = index;
+    }
+    void generate(result_type *first, std::size_t n) { generate(first, first + n); }
 
   private:
     status_type S;
@@ -242,6 +257,24 @@ namespace trng {
       S.index &= mask_B;
       S.r[S.index] = S.r[(S.index - A) & mask_B] + S.r[(S.index - B) & mask_B];
     }
+
+    using polynomial_type = lagfib_polynomial<result_type>;
+
+    // jump ahead by s_partial + B steps, where h(x) = x^s_partial mod f(x), the final B
+    // ordinary steps update the remaining entries of the status buffer
+    void jump(const polynomial_type &h, unsigned long long s_partial) {
+      constexpr auto mask = int_math::mask(B);
+      std::vector<result_type> x(B), y(B);
+      for (unsigned int i{0}; i < B; ++i)
+        x[B - 1 - i] = S.r[(S.index - i) & mask];
+      h.apply(x.data(), y.data(), B);
+      S.index = static_cast<unsigned int>(S.index + s_partial);
+      S.index &= mask;
+      for (unsigned int i{0}; i < B; ++i)
+        S.r[(S.index - i) & mask] = y[B - 1 - i];
+      for (unsigned int i{0}; i < B; ++i)
+        step();
+    }
   };
 
   typedef lagfib2plus<unsigned long, 168, 521> lagfib2plus_521_ul;
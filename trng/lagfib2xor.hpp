@@ -156,7 +156,8 @@ namespace trng {
       using matrix_type = matrix<GF2, matrix_size>;
       using vector_type = vector<result_type, matrix_size>;
       using size_type = typename matrix_type::size_type;
-      const unsigned long long n_pivot{int_math::log2_ceil(n) * B * B * B};
+      // a product of bit-packed matrices takes about B^3 / 256 times as long as a step
+      const unsigned long long n_pivot{(int_math::log2_ceil(n) + 1) * B * B * B / 256};
       constexpr auto mask = int_math::mask(B);
       if (n > n_pivot) {
         const unsigned long long n_partial{n - matrix_size};
@@ -169,13 +170,7 @@ namespace trng {
         vector_type V;
         for (size_type i{0}; i < matrix_size; ++i)
           V(matrix_size - 1 - i) = S.r[(S.index - i) & mask];
-        vector_type W;
-        for (size_type i{0}; i < matrix_size; ++i) {
-          result_type sum{};
-          for (size_type k{0}; k < matrix_size; ++k)
-            sum ^= M(i, k) * V(k);
-          W(i) = sum;
-        }
+        const vector_type W(M * V);
         S.index = static_cast<unsigned int>(S.index + n_partial);
         S.index &= mask;
         for (size_type i{0}; i < matrix_size; ++i)
@@ -234,6 +229,19 @@ namespace trng {
     long operator()(long x) {
       return static_cast<long>(utility::uniformco<double, lagfib2xor>(*this) * x);
     }
+    template<typename iter>
+    void generate(iter first, iter last) {
+      constexpr auto mask_B{int_math::mask(static_cast<decltype(S.index)>(B))};
+      unsigned int index{S.index};
+      for (; first != last; ++first) {
+        ++index;
+        index &= mask_B;
+        S.r[index] = S.r[(index - A) & mask_B] ^ S.r[(index - B) & mask_B];
+        *first = S.r[index];
+      }
+      S.index = index;
+    }
+    void generate(result_type *first, std::size_t n) { generate(first, first + n); }
 
   private:
     status_type S;
@@ -38,11 +38,14 @@
 #include <trng/utility.hpp>
 #include <trng/minstd.hpp>
 #include <trng/int_types.hpp>
+#include <trng/int_math.hpp>
+#include <trng/lagfib_polynomial.hpp>
 #include <climits>
 #include <stdexcept>
 #include <ostream>
 #include <istream>
 #include <sstream>
+#include <vector>
 #if defined _MSC_VER && __cplusplus <= 201703
 #include <ciso646>
 #endif
@@ -151,35 +154,33 @@ namespace trng {
       S.index = D - 1;
     }
 
-    void discard(unsigned long long n) {
-      const unsigned int matrix_size = D;
-      using matrix_type = matrix<result_type, matrix_size>;
-      using vector_type = vector<result_type, matrix_size>;
-      using size_type = typename matrix_type::size_type;
-      const unsigned long long n_pivot{int_math::log2_ceil(n) * D * D * D};
-      constexpr auto mask = int_math::mask(D);
-      if (n > n_pivot) {
-        const unsigned long long n_partial{n - matrix_size};
-        matrix_type M;
-        for (size_type i{0}; i < matrix_size - 1; ++i)
-          M(i, i + 1) = 1;
-        M(matrix_size - 1, matrix_size - D) = 1;
-        M(matrix_size - 1, matrix_size - C) = 1;
-        M(matrix_size - 1, matrix_size - B) = 1;
-        M(matrix_size - 1, matrix_size - A) = 1;
-        M = power(M, n_partial);
-        vector_type V;
-        for (size_type i{0}; i < matrix_size; ++i)
-          V(matrix_size - 1 - i) = S.r[(S.index - i) & mask];
-        V = M * V;
-        S.index = static_cast<unsigned int>(S.index + n_partial);
-        S.index &= mask;
-        for (size_type i{0}; i < matrix_size; ++i)
-          S.r[(S.index - i) & mask] = V(matrix_size - 1 - i);
-        n -= n_partial;
+    void discard(unsigned long long n) { jump(n); }
+
+    // Parallel random number generator concept, jump ahead via the characteristic polynomial
+    // of the recurrence, there is no leapfrog splitting
+    void jump2(unsigned int s) {
+      if (s < 64u) {
+        jump(1ull << s);
+      } else {
+        polynomial_type h({A, B, C, D});
+        h.power2_x(s);
+        for (unsigned int i{0}; i < D; ++i)
+          h.div_x();
+        // 2^s is divisible by the size of the status buffer
+        jump(h, 0ull - D);
+      }
+    }
+
+    void jump(unsigned long long s) {
+      const unsigned long long s_pivot{(int_math::log2_ceil(s) + 1) * D * D / 2};
+      if (s > s_pivot) {
+        polynomial_type h({A, B, C, D});
+        h.power_x(s - D);
+        jump(h, s - D);
+      } else {
+        for (unsigned long long i{0}; i < s; ++i)
+          step();
       }
-      for (unsigned long long i{0}; i < n; ++i)
-        step();
     }
 
     // Equality comparable concept
@@ -234,6 +235,20 @@ namespace trng {
     long operator()(long x) {
       return static_cast<long>(utility::uniformco<double, lagfib4plus>(*this) * x);
     }
+    template<typename iter>
+    void generate(iter first, iter last) {
+      constexpr auto mask_D{int_math::mask(static_cast<decltype(S.index)>(D))};
+      unsigned int index{S.index};
+      for (; first != last; ++first) {
+        ++index;
+        index &= mask_D;
+        S.r[index] = S.r[(index - A) & mask_D] + S.r[(index - B) & mask_D] +
+                     S.r[(index - C) & mask_D] + S.r[(index - D) & mask_D];
+        *first = S.r[index];
+      }
+      S.index = index;
+    }
+    void generate(result_type *first, std::size_t n) { generate(first, first + n); }
 
   private:
     status_type S;
@@ -245,6 +260,24 @@ namespace trng {
       S.r[S.index] = S.r[(S.index - A) & mask_D] + S.r[(S.index - B) & mask_D] +
                      S.r[(S.index - C) & mask_D] + S.r[(S.index - D) & mask_D];
     }
+
+    using polynomial_type = lagfib_polynomial<result_type>;
+
+    // jump ahead by s_partial + D steps, where h(x) = x^s_partial mod f(x), the final D
+    // ordinary steps update the remaining entries of the status buffer
+    void jump(const polynomial_type &h, unsigned long long s_partial) {
+      constexpr auto mask = int_math::mask(D);
+      std::vector<result_type> x(D), y(D);
+      for (unsigned int i{0}; i < D; ++i)
+        x[D - 1 - i] = S.r[(S.index - i) & mask];
+      h.apply(x.data(), y.data(), D);
+      S.index = static_cast<unsigned int>(S.index + s_partial);
+      S.index &= mask;
+      for (unsigned int i{0}; i < D; ++i)
+        S.r[(S.index - i) & mask] = y[D - 1 - i];
+      for (unsigned int i{0}; i < D; ++i)
+        step();
+    }
   };
 
   typedef lagfib4plus<unsigned long, 168, 205, 242, 521> lagfib4plus_521_ul;
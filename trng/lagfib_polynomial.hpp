@@ -0,0 +1,155 @@
+// Copyright (c) 2000-2026, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_LAGFIB_POLYNOMIAL_HPP)
+
+#define TRNG_LAGFIB_POLYNOMIAL_HPP
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <initializer_list>
+#if defined _MSC_VER && __cplusplus <= 201703
+#include <ciso646>
+#endif
+
+namespace trng {
+
+  // Polynomials modulo f(x) = x^p - x^(p - l_1) - ... - x^(p - l_m) with coefficients in the
+  // integers modulo 2^w, where p = max(l_1, ..., l_m) and w is the number of bits of the
+  // unsigned type T.  f is the characteristic polynomial of the additive lagged Fibonacci
+  // recurrence x_k = x_{k - l_1} + ... + x_{k - l_m} modulo 2^w, i.e., the sequence satisfies
+  // x_{k + s} = h_0 x_k + ... + h_{p - 1} x_{k + p - 1} with h(x) = x^s mod f(x).  Thus, a
+  // jump by s steps takes O(p^2 log s) operations instead of O(p^3 log s) for powers of the
+  // companion matrix.
+  template<typename T>
+  class lagfib_polynomial {
+    std::vector<unsigned int> l;
+    unsigned int p{0};
+    // coefficients of x^0 to x^(p - 1)
+    std::vector<T> c;
+
+    // reduce coefficients of degree up to 2 p - 2 modulo f
+    void reduce(std::vector<T> &v) const {
+      for (std::size_t d{v.size()}; d-- > p;)
+        if (v[d] != 0) {
+          for (unsigned int l_i : l)
+            v[d - l_i] += v[d];
+          v[d] = 0;
+        }
+      v.resize(p);
+    }
+
+  public:
+    // the polynomial 1
+    explicit lagfib_polynomial(std::initializer_list<unsigned int> lags) : l(lags) {
+      for (unsigned int l_i : l)
+        if (l_i > p)
+          p = l_i;
+      c.resize(p, 0);
+      c[0] = 1;
+    }
+
+    void square() {
+      std::vector<T> v(2 * p - 1, 0);
+      for (unsigned int i{0}; i < p; ++i) {
+        if (c[i] == 0)
+          continue;
+        v[2 * i] += c[i] * c[i];
+        const T c_i2{static_cast<T>(2 * c[i])};
+        for (unsigned int j{i + 1}; j < p; ++j)
+          v[i + j] += c_i2 * c[j];
+      }
+      reduce(v);
+      c.swap(v);
+    }
+
+    void mult_x() {
+      c.insert(c.begin(), T(0));
+      reduce(c);
+    }
+
+    // h(x) / x mod f(x), the constant term of f is -1 as p is one of the lags
+    void div_x() {
+      const T h_0{c[0]};
+      for (unsigned int i{0}; i + 1 < p; ++i)
+        c[i] = c[i + 1];
+      c[p - 1] = 0;
+      // h + h_0 f is divisible by x
+      c[p - 1] += h_0;
+      for (unsigned int l_i : l)
+        if (l_i < p)
+          c[p - l_i - 1] -= h_0;
+    }
+
+    // x^e mod f
+    void power_x(unsigned long long e) {
+      std::fill(c.begin(), c.end(), T(0));
+      c[0] = 1;
+      int i{63};
+      while (i >= 0 and ((e >> i) & 1u) == 0)
+        --i;
+      for (; i >= 0; --i) {
+        square();
+        if ((e >> i) & 1u)
+          mult_x();
+      }
+    }
+
+    // x^(2^k) mod f
+    void power2_x(unsigned int k) {
+      std::fill(c.begin(), c.end(), T(0));
+      c[0] = 1;
+      mult_x();
+      for (unsigned int i{0}; i < k; ++i)
+        square();
+    }
+
+    // x_s, ..., x_{s + n - 1} from x_0, ..., x_{p - 1}, where h(x) = x^s mod f(x)
+    void apply(const T *x, T *y, std::size_t n) const {
+      std::vector<T> z(x, x + p);
+      z.resize(p + n - 1);
+      for (std::size_t k{p}; k < z.size(); ++k)
+        for (unsigned int l_i : l)
+          z[k] += z[k - l_i];
+      for (std::size_t k{0}; k < n; ++k) {
+        T sum{0};
+        for (unsigned int i{0}; i < p; ++i)
+          sum += c[i] * z[k + i];
+        y[k] = sum;
+      }
+    }
+  };
+
+}  // namespace trng
+
+#endif
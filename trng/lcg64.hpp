@@ -80,6 +80,9 @@ namespace trng {
     // compute sum(a^i, i=0..s-1)
     TRNG_CUDA_ENABLE
     static result_type f(result_type s, result_type a);
+    // compute the multiplicative inverse of odd a modulo 2^64
+    TRNG_CUDA_ENABLE
+    static result_type inverse(result_type a);
 
   public:
     // Parameter and status classes
@@ -235,6 +238,15 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    template<typename iter>
+    TRNG_CUDA_ENABLE void generate(iter, iter);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
+    // random number that the (k + 1)-th call of operator() returns, state is not changed
+    TRNG_CUDA_ENABLE
+    result_type value_at(unsigned long long) const;
+    template<typename iter, typename out_iter>
+    TRNG_CUDA_ENABLE void values_at(iter, iter, out_iter) const;
 
   private:
     parameter_type P;
@@ -263,6 +275,33 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, lcg64>(*this) * x);
   }
 
+  template<typename iter>
+  TRNG_CUDA_ENABLE inline void lcg64::generate(iter first, iter last) {
+    const result_type a{P.a}, b{P.b};
+    result_type r{S.r};
+    for (; first != last; ++first) {
+      r = a * r + b;
+      *first = r;
+    }
+    S.r = r;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void lcg64::generate(result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
+  TRNG_CUDA_ENABLE
+  inline lcg64::result_type lcg64::value_at(unsigned long long k) const {
+    return S.r * pow(P.a, k + 1) + f(k + 1, P.a) * P.b;
+  }
+
+  template<typename iter, typename out_iter>
+  TRNG_CUDA_ENABLE inline void lcg64::values_at(iter first, iter last, out_iter out) const {
+    for (; first != last; ++first, ++out)
+      *out = value_at(*first);
+  }
+
   // compute floor(log_2(x))
   TRNG_CUDA_ENABLE
   inline unsigned int lcg64::log2_floor(lcg64::result_type x) {
@@ -304,17 +343,29 @@ namespace trng {
   inline lcg64::result_type lcg64::f(lcg64::result_type s, lcg64::result_type a) {
     if (s == 0)
       return 0;
-    const unsigned int e{log2_floor(s)};
-    lcg64::result_type y{0}, p{a};
-    for (unsigned int l{0}; l <= e; ++l) {
-      if (((1ull << l) & s) > 0) {
-        y = g(l, a) + p * y;
-      }
+    // y = sum(a^i, i=0..k-1) and p = a^k, where k is given by the leading bits of s
+    lcg64::result_type y{0}, p{1};
+    for (unsigned int l{log2_floor(s) + 1}; l-- > 0;) {
+      y *= 1 + p;
       p *= p;
+      if (((s >> l) & 1u) > 0) {
+        y += p;
+        p *= a;
+      }
     }
     return y;
   }
 
+  // compute the multiplicative inverse of odd a modulo 2^64
+  TRNG_CUDA_ENABLE
+  inline lcg64::result_type lcg64::inverse(lcg64::result_type a) {
+    // a * a = 1 modulo 2^3, each Newton step doubles the number of correct bits
+    lcg64::result_type x{a};
+    for (int i{0}; i < 5; ++i)
+      x *= 2 - a * x;
+    return x;
+  }
+
   // Parallel random number generator concept
 
   TRNG_CUDA_ENABLE
@@ -333,7 +384,10 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void lcg64::jump2(unsigned int s) {
-    S.r = S.r * pow(P.a, 1ull << s) + f(1ull << s, P.a) * P.b;
+    result_type a_s{P.a};
+    for (unsigned int i{0}; i < s; ++i)
+      a_s *= a_s;
+    S.r = S.r * a_s + g(s, P.a) * P.b;
   }
 
   TRNG_CUDA_ENABLE
@@ -342,13 +396,7 @@ namespace trng {
       for (unsigned int i{0}; i < s; ++i)
         step();
     } else {
-      unsigned int i{0};
-      while (s > 0) {
-        if (s % 2 == 1)
-          jump2(i);
-        ++i;
-        s >>= 1u;
-      }
+      S.r = S.r * pow(P.a, s) + f(s, P.a) * P.b;
     }
   }
 
@@ -357,8 +405,7 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void lcg64::backward() {
-    for (unsigned int i{0}; i < 64; ++i)
-      jump2(i);
+    S.r = (S.r - P.b) * inverse(P.a);
   }
 
 }  // namespace trng
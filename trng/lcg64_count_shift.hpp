@@ -81,6 +81,9 @@ namespace trng {
     // compute sum(a^i, i=0..s-1)
     TRNG_CUDA_ENABLE
     static result_type f(result_type s, result_type a);
+    // compute the multiplicative inverse of odd a modulo 2^64
+    TRNG_CUDA_ENABLE
+    static result_type inverse(result_type a);
     // compute a * b mod m
     TRNG_CUDA_ENABLE
     static result_type mult_modulo(result_type a, result_type b);
@@ -249,6 +252,15 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    template<typename iter>
+    TRNG_CUDA_ENABLE void generate(iter, iter);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
+    // random number that the (k + 1)-th call of operator() returns, state is not changed
+    TRNG_CUDA_ENABLE
+    result_type value_at(unsigned long long) const;
+    template<typename iter, typename out_iter>
+    TRNG_CUDA_ENABLE void values_at(iter, iter, out_iter) const;
 
   private:
     parameter_type P;
@@ -286,6 +298,50 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, lcg64_count_shift>(*this) * x);
   }
 
+  template<typename iter>
+  TRNG_CUDA_ENABLE inline void lcg64_count_shift::generate(iter first, iter last) {
+    const result_type a{P.a}, b{P.b}, inc{P.inc};
+    result_type r{S.r}, count{S.count};
+    for (; first != last; ++first) {
+      r = a * r + b;
+      count += inc;
+      if (count >= modulus)
+        count -= modulus;
+      result_type t{r + count};
+      t ^= (t >> 17u);
+      t ^= (t << 31u);
+      t ^= (t >> 8u);
+      *first = t;
+    }
+    S.r = r;
+    S.count = count;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void lcg64_count_shift::generate(result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
+  TRNG_CUDA_ENABLE
+  inline lcg64_count_shift::result_type lcg64_count_shift::value_at(
+      unsigned long long k) const {
+    result_type count{S.count + mult_modulo(P.inc, k % modulus + 1)};
+    if (count >= modulus)
+      count -= modulus;
+    result_type t{S.r * pow(P.a, k + 1) + f(k + 1, P.a) * P.b + count};
+    t ^= (t >> 17u);
+    t ^= (t << 31u);
+    t ^= (t >> 8u);
+    return t;
+  }
+
+  template<typename iter, typename out_iter>
+  TRNG_CUDA_ENABLE inline void lcg64_count_shift::values_at(iter first, iter last,
+                                                            out_iter out) const {
+    for (; first != last; ++first, ++out)
+      *out = value_at(*first);
+  }
+
   // compute floor(log_2(x))
   TRNG_CUDA_ENABLE
   inline unsigned int lcg64_count_shift::log2_floor(lcg64_count_shift::result_type x) {
@@ -330,17 +386,30 @@ namespace trng {
                                                              lcg64_count_shift::result_type a) {
     if (s == 0)
       return 0;
-    const unsigned int e{log2_floor(s)};
-    lcg64_count_shift::result_type y{0}, p{a};
-    for (unsigned int l{0}; l <= e; ++l) {
-      if (((1ull << l) & s) > 0) {
-        y = g(l, a) + p * y;
-      }
+    // y = sum(a^i, i=0..k-1) and p = a^k, where k is given by the leading bits of s
+    lcg64_count_shift::result_type y{0}, p{1};
+    for (unsigned int l{log2_floor(s) + 1}; l-- > 0;) {
+      y *= 1 + p;
       p *= p;
+      if (((s >> l) & 1u) > 0) {
+        y += p;
+        p *= a;
+      }
     }
     return y;
   }
 
+  // compute the multiplicative inverse of odd a modulo 2^64
+  TRNG_CUDA_ENABLE
+  inline lcg64_count_shift::result_type lcg64_count_shift::inverse(
+      lcg64_count_shift::result_type a) {
+    // a * a = 1 modulo 2^3, each Newton step doubles the number of correct bits
+    lcg64_count_shift::result_type x{a};
+    for (int i{0}; i < 5; ++i)
+      x *= 2 - a * x;
+    return x;
+  }
+
   // compute a * b mod m
   TRNG_CUDA_ENABLE
   inline lcg64_count_shift::result_type lcg64_count_shift::mult_modulo(
@@ -385,7 +454,10 @@ namespace trng {
   TRNG_CUDA_ENABLE
   inline void lcg64_count_shift::jump2(unsigned int s) {
     // LCG part
-    S.r = S.r * pow(P.a, 1ull << s) + f(1ull << s, P.a) * P.b;
+    result_type a_s{P.a};
+    for (unsigned int i{0}; i < s; ++i)
+      a_s *= a_s;
+    S.r = S.r * a_s + g(s, P.a) * P.b;
     // counting part
     result_type powers_of_2{1};
     for (unsigned int i{1}; i <= s; ++i)
@@ -402,14 +474,7 @@ namespace trng {
         step();
     } else {
       // LCG part
-      unsigned int i{0};
-      unsigned long long s_l{s};
-      while (s_l > 0) {
-        if (s_l % 2 == 1)
-          S.r = S.r * pow(P.a, 1ull << i) + f(1ull << i, P.a) * P.b;  // jump2(i)
-        ++i;
-        s_l >>= 1u;
-      }
+      S.r = S.r * pow(P.a, s) + f(s, P.a) * P.b;
       // counting part
       S.count += mult_modulo(P.inc, s);
       if (S.count >= modulus)
@@ -422,8 +487,7 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void lcg64_count_shift::backward() {
-    for (unsigned int i{0}; i < 64; ++i)
-      S.r = S.r * pow(P.a, 1ull << i) + f(1ull << i, P.a) * P.b;
+    S.r = (S.r - P.b) * inverse(P.a);
     S.count += modulus - P.inc;
     if (S.count >= modulus)
       S.count -= modulus;
@@ -36,6 +36,8 @@
 
 #include <vector>
 #include <cstddef>
+#include <cstdint>
+#include <algorithm>
 #if defined _MSC_VER && __cplusplus <= 201703
 #include <ciso646>
 #endif
@@ -284,6 +286,150 @@ namespace trng {
   }
 
 
+  // Bit-packed matrices over GF(2), rows are stored in consecutive 64-bit words.  Products are
+  // computed by the method of four Russians, which reduces n^3 bit operations to about
+  // n^3 / (8 * 64) word operations.
+  template<std::size_t n>
+  class matrix<GF2, n> {
+  public:
+    using word_type = std::uint64_t;
+    using size_type = std::size_t;
+    using const_reference = GF2;
+
+    static constexpr size_type word_bits{64};
+    // number of words per row
+    static constexpr size_type words{(n + word_bits - 1) / word_bits};
+
+    class reference {
+      word_type &w;
+      const word_type bit;
+
+      reference(word_type &w, word_type bit) : w(w), bit(bit) {}
+
+    public:
+      friend class matrix;
+
+      operator GF2() const { return GF2((w & bit) != 0); }
+
+      reference &operator=(const GF2 value) {
+        if (static_cast<bool>(value))
+          w |= bit;
+        else
+          w &= ~bit;
+        return *this;
+      }
+
+      reference &operator=(const reference &other) { return *this = static_cast<GF2>(other); }
+    };
+
+  private:
+    std::vector<word_type> data;
+
+  public:
+    matrix() : data(n * words, 0) {}
+
+    template<typename F>
+    explicit matrix(F f) : data(n * words, 0) {
+      static_assert(trng::utility::is_same<GF2, decltype(f(0, 0))>::value,
+                    "wrong return type of functor");
+      for (size_type i{0}; i < n; ++i)
+        for (size_type j{0}; j < n; ++j)
+          (*this)(i, j) = f(i, j);
+    }
+
+    template<typename... Ts>
+    explicit matrix(Ts... t) : data(n * words, 0) {
+      static_assert(sizeof...(Ts) == n * n, "wrong number of arguments");
+      static_assert(trng::utility::is_same<GF2, Ts...>::value,
+                    "wrong type in constructor argument");
+      const GF2 values[]{t...};
+      for (size_type i{0}; i < n; ++i)
+        for (size_type j{0}; j < n; ++j)
+          (*this)(i, j) = values[j + i * n];
+    }
+
+    reference operator()(size_type i, size_type j) {
+      return reference(data[j / word_bits + i * words], word_type(1) << (j % word_bits));
+    }
+    const_reference operator()(size_type i, size_type j) const {
+      return GF2(((data[j / word_bits + i * words] >> (j % word_bits)) & 1u) == 1u);
+    }
+    // bit j % 64 of row(i)[j / 64] holds the element in row i and column j
+    word_type *row(size_type i) { return data.data() + i * words; }
+    const word_type *row(size_type i) const { return data.data() + i * words; }
+    constexpr size_type size() const { return n; }
+    bool operator==(const matrix &other) const { return data == other.data; }
+    bool operator!=(const matrix &other) const { return data != other.data; }
+  };
+
+
+  template<std::size_t n>
+  matrix<GF2, n> operator*(const matrix<GF2, n> &a, const matrix<GF2, n> &b) {
+    using matrix_type = matrix<GF2, n>;
+    using size_type = typename matrix_type::size_type;
+    using word_type = typename matrix_type::word_type;
+    constexpr size_type words{matrix_type::words}, word_bits{matrix_type::word_bits};
+    // number of rows of b that are combined in a table
+    constexpr size_type k_bits{8};
+    matrix_type res;
+    std::vector<word_type> table((size_type(1) << k_bits) * words);
+    for (size_type k0{0}; k0 < n; k0 += k_bits) {
+      const size_type k_end{utility::min(n, k0 + k_bits)};
+      // table entry c holds the sum of all rows k0 + l of b with bit l of c set, entries are
+      // built in Gray code order such that each one takes a single row addition
+      std::fill(table.begin(), table.begin() + words, word_type(0));
+      for (size_type c{1}, c_end{size_type(1) << (k_end - k0)}; c < c_end; ++c) {
+        size_type l{0};
+        while (((c >> l) & 1u) == 0)
+          ++l;
+        const size_type g{c ^ (c >> 1u)}, g_prev{g ^ (size_type(1) << l)};
+        const word_type *src{b.row(k0 + l)};
+        word_type *dst{table.data() + g * words}, *prev{table.data() + g_prev * words};
+        for (size_type w{0}; w < words; ++w)
+          dst[w] = prev[w] ^ src[w];
+      }
+      const size_type k_word{k0 / word_bits}, k_shift{k0 % word_bits};
+      const word_type k_mask{(word_type(1) << (k_end - k0)) - 1u};
+      for (size_type i{0}; i < n; ++i) {
+        // k0 is a multiple of 8, thus bits k0 to k_end - 1 lie within a single word
+        const size_type c{static_cast<size_type>((a.row(i)[k_word] >> k_shift) & k_mask)};
+        if (c != 0) {
+          const word_type *src{table.data() + c * words};
+          word_type *dst{res.row(i)};
+          for (size_type w{0}; w < words; ++w)
+            dst[w] ^= src[w];
+        }
+      }
+    }
+    return res;
+  }
+
+
+  // product of a GF(2) matrix and a vector of bit strings, i.e., each bit position is multiplied
+  // independently
+  template<typename T, std::size_t n>
+  typename std::enable_if<std::is_integral<T>::value, vector<T, n>>::type operator*(
+      const matrix<GF2, n> &a, const vector<T, n> &b) {
+    using matrix_type = matrix<GF2, n>;
+    using size_type = typename matrix_type::size_type;
+    using word_type = typename matrix_type::word_type;
+    constexpr size_type word_bits{matrix_type::word_bits};
+    vector<T, n> res;
+    for (size_type i{0}; i < n; ++i) {
+      const word_type *r{a.row(i)};
+      T sum{0};
+      for (size_type w{0}; w < matrix_type::words; ++w) {
+        size_type k{w * word_bits};
+        for (word_type bits{r[w]}; bits != 0; bits >>= 1u, ++k)
+          if ((bits & 1u) == 1u)
+            sum ^= b(k);
+      }
+      res(i) = sum;
+    }
+    return res;
+  }
+
+
 }  // namespace trng
 
 #endif
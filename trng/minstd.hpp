@@ -153,6 +153,9 @@ namespace trng {
     // Other useful methods
     static const char *name();
     long operator()(long);
+    template<typename iter>
+    void generate(iter, iter);
+    void generate(result_type *, std::size_t);
 
   private:
     status_type S;
@@ -186,6 +189,23 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, minstd>(*this) * x);
   }
 
+  template<typename iter>
+  inline void minstd::generate(iter first, iter last) {
+    uint64_t r{S.r};
+    for (; first != last; ++first) {
+      r *= static_cast<uint64_t>(16807);
+      r = (r & 0x7fffffffu) + (r >> 31u);
+      if (r >= 2147483647u)
+        r -= 2147483647u;
+      *first = static_cast<result_type>(r);
+    }
+    S.r = static_cast<result_type>(r);
+  }
+
+  inline void minstd::generate(result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
 }  // namespace trng
 
 #endif
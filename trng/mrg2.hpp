@@ -41,6 +41,7 @@
 #include <trng/int_math.hpp>
 #include <trng/mrg_parameter.hpp>
 #include <trng/mrg_status.hpp>
+#include <trng/mrg_jump_table.hpp>
 #include <ostream>
 #include <istream>
 #include <stdexcept>
@@ -141,12 +142,23 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    template<typename iter>
+    TRNG_CUDA_ENABLE void generate(iter, iter);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
 
   private:
     parameter_type P;
     status_type S;
     static const char *const name_str;
 
+    using jump_table = mrg_jump_table<2, modulus>;
+
+    template<typename, int>
+    friend class simd_lanes;
+    template<typename>
+    friend class mrg_split_plan;
+
     TRNG_CUDA_ENABLE
     void backward();
     TRNG_CUDA_ENABLE
@@ -174,6 +186,25 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, mrg2>(*this) * x);
   }
 
+  template<typename iter>
+  TRNG_CUDA_ENABLE inline void mrg2::generate(iter first, iter last) {
+    const uint64_t a0{static_cast<uint64_t>(P.a[0])}, a1{static_cast<uint64_t>(P.a[1])};
+    result_type r0{S.r[0]}, r1{S.r[1]};
+    for (; first != last; ++first) {
+      const uint64_t t{a0 * static_cast<uint64_t>(r0) + a1 * static_cast<uint64_t>(r1)};
+      r1 = r0;
+      r0 = int_math::modulo<modulus, 2>(t);
+      *first = r0;
+    }
+    S.r[0] = r0;
+    S.r[1] = r1;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void mrg2::generate(result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
   // Parallel random number generator concept
   TRNG_CUDA_ENABLE
   inline void mrg2::split(unsigned int s, unsigned int n) {
@@ -197,7 +228,7 @@ namespace trng {
       a[1] = q3;
       b[2] = q2;
       b[3] = q1;
-      int_math::gauss<2>(b, a, modulus);
+      int_math::gauss<2, modulus>(b, a);
       P.a[0] = a[0];
       P.a[1] = a[1];
       S.r[0] = q1;
@@ -209,24 +240,30 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void mrg2::jump2(unsigned int s) {
+#if !(defined TRNG_CUDA)
+    if (s < jump_table::levels) {
+      jump_table::jump2(P.a, S.r, s);
+      return;
+    }
+#endif
     result_type b[4], c[4]{};
     b[0] = P.a[0];
     b[1] = P.a[1];
     b[2] = 1;
     b[3] = 0;
     for (unsigned int i{0}; i < s; ++i) {
-      int_math::matrix_mult<2>(b, b, c, modulus);
+      int_math::matrix_mult<2, modulus>(b, b, c);
       ++i;
       if (not(i < s))
         break;
-      int_math::matrix_mult<2>(c, c, b, modulus);
+      int_math::matrix_mult<2, modulus>(c, c, b);
     }
     const result_type r[2]{S.r[0], S.r[1]};
     result_type d[2];
     if ((s & 1u) == 0)
-      int_math::matrix_vec_mult<2>(b, r, d, modulus);
+      int_math::matrix_vec_mult<2, modulus>(b, r, d);
     else
-      int_math::matrix_vec_mult<2>(c, r, d, modulus);
+      int_math::matrix_vec_mult<2, modulus>(c, r, d);
     S.r[0] = d[0];
     S.r[1] = d[1];
   }
@@ -237,6 +274,7 @@ namespace trng {
       for (unsigned int i{0}; i < s; ++i)
         step();
     } else {
+#if defined TRNG_CUDA
       unsigned int i{0};
       while (s > 0) {
         if (s % 2 == 1)
@@ -244,6 +282,9 @@ namespace trng {
         ++i;
         s >>= 1u;
       }
+#else
+      jump_table::jump(P.a, S.r, s);
+#endif
     }
   }
 
@@ -0,0 +1,190 @@
+// Copyright (c) 2000-2026, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#if !(defined TRNG_MRG_JUMP_TABLE_HPP)
+
+#define TRNG_MRG_JUMP_TABLE_HPP
+
+#include <trng/int_types.hpp>
+#include <trng/int_math.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace trng {
+
+  // Table of the powers A^(2^i), i = 0, ..., levels - 1, of the companion matrix A of a
+  // multiple recursive generator with n coefficients and modulus m.  With the table, a jump
+  // by s steps takes O(log s) matrix-vector products instead of O(log^2 s) matrix products.
+  // Tables are built on first use and are shared by all generators with the same
+  // coefficients.  Access is thread-safe, tables are immutable once built.  Jumps that need
+  // fewer than direct_levels powers are computed without a table.
+  template<int n, int32_t m>
+  class mrg_jump_table {
+  public:
+    static constexpr unsigned int levels{64};
+    static constexpr unsigned int direct_levels{8};
+
+    // shared table for the coefficients a
+    static std::shared_ptr<const mrg_jump_table> get(const int32_t (&a)[n]) {
+      std::array<int32_t, n> key;
+      std::copy(a, a + n, key.begin());
+      cache &c{shared_cache()};
+      {
+        std::lock_guard<std::mutex> lock(c.mutex);
+        auto i{c.find(key)};
+        if (i != c.tables.end())
+          return i->second.first;
+      }
+      // tables are built without holding the lock, if several threads build the same table
+      // concurrently, the first one that is inserted is kept
+      std::shared_ptr<const mrg_jump_table> table(new mrg_jump_table(a));
+      std::lock_guard<std::mutex> lock(c.mutex);
+      auto i{c.find(key)};
+      if (i != c.tables.end())
+        return i->second.first;
+      c.insert(key, table);
+      return table;
+    }
+
+    // advance status vector r of a generator with coefficients a by s steps
+    static void jump(const int32_t (&a)[n], int32_t (&r)[n], unsigned long long s) {
+      if (s >= (1ull << direct_levels)) {
+        get(a)->jump(r, s);
+        return;
+      }
+      int32_t A[n * n], B[n * n];
+      companion(a, A);
+      while (true) {
+        if ((s & 1u) == 1u)
+          apply(A, r);
+        s >>= 1u;
+        if (s == 0)
+          break;
+        int_math::matrix_mult<n, m>(A, A, B);
+        std::copy(B, B + n * n, A);
+      }
+    }
+
+    // advance status vector r of a generator with coefficients a by 2^s steps, s must be less
+    // than levels
+    static void jump2(const int32_t (&a)[n], int32_t (&r)[n], unsigned int s) {
+      if (s >= direct_levels) {
+        get(a)->jump2(r, s);
+        return;
+      }
+      int32_t A[n * n], B[n * n];
+      companion(a, A);
+      for (unsigned int i{0}; i < s; ++i) {
+        int_math::matrix_mult<n, m>(A, A, B);
+        std::copy(B, B + n * n, A);
+      }
+      apply(A, r);
+    }
+
+    // advance status vector r by s steps
+    void jump(int32_t (&r)[n], unsigned long long s) const {
+      for (unsigned int i{0}; s > 0; ++i, s >>= 1u)
+        if ((s & 1u) == 1u)
+          jump2(r, i);
+    }
+
+    // advance status vector r by 2^s steps, s must be less than levels
+    void jump2(int32_t (&r)[n], unsigned int s) const { apply(A[s], r); }
+
+  private:
+    using key_type = std::array<int32_t, n>;
+
+    // split generators have parameter sets of their own, the cache is bounded therefore and
+    // evicts the least recently used table
+    struct cache {
+      static constexpr std::size_t size{256};
+      using table_ptr = std::shared_ptr<const mrg_jump_table>;
+      using lru_list = std::list<key_type>;
+      using table_map = std::map<key_type, std::pair<table_ptr, typename lru_list::iterator>>;
+
+      std::mutex mutex;
+      lru_list lru;
+      table_map tables;
+
+      typename table_map::iterator find(const key_type &key) {
+        auto i{tables.find(key)};
+        if (i != tables.end())
+          lru.splice(lru.begin(), lru, i->second.second);
+        return i;
+      }
+
+      void insert(const key_type &key, const table_ptr &table) {
+        if (tables.size() >= size) {
+          tables.erase(lru.back());
+          lru.pop_back();
+        }
+        lru.push_front(key);
+        tables.emplace(key, std::make_pair(table, lru.begin()));
+      }
+    };
+
+    static cache &shared_cache() {
+      static cache c;
+      return c;
+    }
+
+    static void companion(const int32_t (&a)[n], int32_t (&A)[n * n]) {
+      std::fill(A, A + n * n, 0);
+      std::copy(a, a + n, A);
+      for (int i{1}; i < n; ++i)
+        A[i * n + i - 1] = 1;
+    }
+
+    static void apply(const int32_t (&A)[n * n], int32_t (&r)[n]) {
+      int32_t d[n];
+      int_math::matrix_vec_mult<n, m>(A, r, d);
+      std::copy(d, d + n, r);
+    }
+
+    int32_t A[levels][n * n];
+
+    explicit mrg_jump_table(const int32_t (&a)[n]) {
+      companion(a, A[0]);
+      for (unsigned int i{1}; i < levels; ++i)
+        int_math::matrix_mult<n, m>(A[i - 1], A[i - 1], A[i]);
+    }
+  };
+
+}  // namespace trng
+
+#endif
@@ -63,6 +63,10 @@ namespace trng {
     }
 
     friend F;
+    template<typename, int>
+    friend class simd_lanes;
+    template<typename>
+    friend class mrg_split_plan;
 
     // Equality comparable concept
     friend bool operator==(const mrg_parameter &P1, const mrg_parameter &P2) {
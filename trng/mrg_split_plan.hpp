@@ -0,0 +1,121 @@
+// Copyright (c) 2000-2026, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_MRG_SPLIT_PLAN_HPP)
+
+#define TRNG_MRG_SPLIT_PLAN_HPP
+
+#include <trng/int_types.hpp>
+#include <trng/int_math.hpp>
+#include <trng/utility.hpp>
+#include <trng/mrg_parameter.hpp>
+#include <trng/mrg_status.hpp>
+#include <algorithm>
+#include <stdexcept>
+#if defined _MSC_VER && __cplusplus <= 201703
+#include <ciso646>
+#endif
+
+namespace trng {
+
+  // Precomputed leapfrog splitting of a multiple recursive generator (mrg2, ..., mrg5s,
+  // yarn2, ..., yarn5s) into s streams.  The parameters of the split streams depend only on
+  // the original parameters and on s, and the state of stream n is a linear function of the
+  // state that is reached by n steps of the original generator.  Both are computed once by
+  // the constructor, such that split(R, n) costs a single jump and a matrix vector product
+  // rather than order + 5 jumps and a Gaussian elimination as R.split(s, n).
+  template<typename engine_t>
+  class mrg_split_plan {
+  public:
+    using engine_type = engine_t;
+    using parameter_type = typename engine_type::parameter_type;
+    using result_type = typename engine_type::result_type;
+
+    // plan for engines with default parameters
+    explicit mrg_split_plan(unsigned int s) : mrg_split_plan(s, engine_type().P) {}
+
+    // plan for engines with the parameters of R
+    mrg_split_plan(unsigned int s, const engine_type &R) : mrg_split_plan(s, R.P) {}
+
+    mrg_split_plan(unsigned int s, const parameter_type &P) : P{P}, P_split{P}, s{s} {
+      if (s < 1)
+        utility::throw_this(std::invalid_argument("invalid argument for trng::mrg_split_plan"));
+      // columns of the state transformation are the split states of the unit vectors
+      for (int j{0}; j < order; ++j) {
+        engine_type R(P);
+        for (int k{0}; k < order; ++k)
+          R.S.r[k] = k == j ? 1 : 0;
+        R.split(s, 0);
+        for (int k{0}; k < order; ++k)
+          A[k * order + j] = R.S.r[k];
+        P_split = R.P;
+      }
+    }
+
+    unsigned int streams() const { return s; }
+    const parameter_type &parameter() const { return P; }
+    const parameter_type &split_parameter() const { return P_split; }
+
+    // equivalent to R.split(s, n), R must have the parameters of this plan
+    void split(engine_type &R, unsigned int n) const {
+      if (n >= s or R.P != P)
+        utility::throw_this(
+            std::invalid_argument("invalid argument for trng::mrg_split_plan::split"));
+      if (s == 1)
+        return;
+      R.jump(n);
+      result_type r[order];
+      std::copy(R.S.r, R.S.r + order, r);
+      int_math::matrix_vec_mult<order, modulus>(A, r, R.S.r);
+      R.P = P_split;
+    }
+
+  private:
+    template<typename T>
+    struct order_of;
+
+    template<typename T, int n, typename F>
+    struct order_of<mrg_parameter<T, n, F>> {
+      static constexpr int value{n};
+    };
+
+    static constexpr int order{order_of<parameter_type>::value};
+    static constexpr result_type modulus{engine_type::modulus};
+
+    parameter_type P, P_split;
+    unsigned int s;
+    result_type A[order * order];
+  };
+
+}  // namespace trng
+
+#endif
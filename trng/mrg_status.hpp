@@ -67,6 +67,10 @@ namespace trng {
     }
 
     friend F;
+    template<typename, int>
+    friend class simd_lanes;
+    template<typename>
+    friend class mrg_split_plan;
 
     // Equality comparable concept
     friend bool operator==(const mrg_status &S1, const mrg_status &S2) {
@@ -31,6 +31,7 @@
 // OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "mt19937.hpp"
+#include <vector>
 
 namespace trng {
 
@@ -80,6 +81,85 @@ namespace trng {
 
   bool operator!=(const mt19937 &R1, const mt19937 &R2) { return not(R1 == R2); }
 
+  // Parallel random number generator concept
+  const gf2_polynomial &mt19937::characteristic_polynomial() {
+    // minimal polynomial of the sequence of least significant bits, which equals the
+    // characteristic polynomial of degree 19937 as the latter is irreducible
+    static const gf2_polynomial f{[]() {
+      mt19937 r;
+      std::vector<bool> s(2 * 19937);
+      for (std::vector<bool>::size_type i{0}; i < s.size(); ++i)
+        s[i] = (r() & 1u) == 1u;
+      return gf2_polynomial::minimal_polynomial(s);
+    }()};
+    return f;
+  }
+
+  // The state words are the values x_b, ..., x_{b + N - 1} of the sequence
+  // x_{k + N} = x_{k + M} ^ twist(x_k, x_{k + 1}), which are consumed from position mti on.
+  // The transition matrix T of the sequence has the minimal polynomial x f(x), because the 31
+  // least significant bits of x_b are discarded in the first step.  Thus, h(T) with
+  // h(x) = x^t mod f(x) equals T^t on the image of T.  A jump by s steps advances the state
+  // words by a multiple of N such that the jumped engine has the same state as an engine that
+  // has generated all skipped numbers.  This takes 1 to 2 N - 1 ordinary steps followed by
+  // h(T) for t = s - N and is independent of the current state.
+  mt19937::jump_polynomial::jump_polynomial(unsigned long long s)
+      : h(power_x_mod(s, characteristic_polynomial())), s_mod_N(static_cast<int>(s % N)) {
+    for (int i{0}; i < N; ++i)
+      h = div_x_mod(h, characteristic_polynomial());
+  }
+
+  void mt19937::jump2(unsigned int s) {
+    if (s < 64u) {
+      jump(1ull << s);
+    } else {
+      const gf2_polynomial &f{characteristic_polynomial()};
+      gf2_polynomial h{power2_x_mod(s, f)};
+      for (int i{0}; i < N; ++i)
+        h = div_x_mod(h, f);
+      int s_mod_N{1};
+      for (unsigned int i{0}; i < s; ++i)
+        s_mod_N = (2 * s_mod_N) % N;
+      jump(jump_polynomial(h, s_mod_N));
+    }
+  }
+
+  void mt19937::jump(const jump_polynomial &J) {
+    // position of the next number within the state words after the jump, and number of
+    // ordinary steps, i.e., the state words advance by s + S.mti - mti steps
+    int mti{(S.mti + J.s_mod_N + N - 1) % N + 1}, steps{S.mti - mti + N};
+    if (steps == 0) {
+      // only if S.mti is zero
+      mti = 0;
+      steps = N;
+    }
+    // state words in a circular buffer, w[j] holds the oldest one
+    result_type w[N], sum[N]{};
+    for (int i{0}; i < N; ++i)
+      w[i] = S.mt[i];
+    int j{0};
+    const result_type mag01[2]{0u, 0x9908b0dfu};
+    auto step = [&w, &j, &mag01]() {
+      const result_type x{(w[j] & UM) | (w[j + 1 < N ? j + 1 : 0] & LM)};
+      w[j] = w[j + M < N ? j + M : j + M - N] ^ (x >> 1u) ^ mag01[x & 0x1u];
+      j = j + 1 < N ? j + 1 : 0;
+    };
+    for (int i{0}; i < steps; ++i)
+      step();
+    for (int i{0}, i_end{J.h.degree()}; i <= i_end; ++i) {
+      if (J.h.coefficient(i)) {
+        for (int k{0}; k < N - j; ++k)
+          sum[k] ^= w[j + k];
+        for (int k{N - j}; k < N; ++k)
+          sum[k] ^= w[j + k - N];
+      }
+      step();
+    }
+    for (int i{0}; i < N; ++i)
+      S.mt[i] = sum[i];
+    S.mti = mti;
+  }
+
   // Other useful methods
   const char *const mt19937::name_str = "mt19937";
 
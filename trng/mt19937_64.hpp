@@ -52,6 +52,7 @@
 #include <trng/int_types.hpp>
 #include <trng/utility.hpp>
 #include <trng/generate_canonical.hpp>
+#include <trng/gf2_polynomial.hpp>
 #include <climits>
 #include <stdexcept>
 #include <ostream>
@@ -159,6 +160,19 @@ namespace trng {
       }
     };
 
+    // Polynomial for jumping ahead by a fixed number of steps, which may be applied to any
+    // number of engines
+    class jump_polynomial {
+      gf2_polynomial h;
+      int s_mod_N;
+
+      jump_polynomial(const gf2_polynomial &h, int s_mod_N) : h(h), s_mod_N(s_mod_N) {}
+
+    public:
+      explicit jump_polynomial(unsigned long long);
+      friend class mt19937_64;
+    };
+
     // Random number engine concept
     mt19937_64();
     explicit mt19937_64(unsigned long);
@@ -182,6 +196,12 @@ namespace trng {
 
     void discard(unsigned long long);
 
+    // Parallel random number generator concept, jump ahead via the characteristic polynomial
+    // of the state transition, there is no leapfrog splitting
+    void jump2(unsigned int);
+    void jump(unsigned long long);
+    void jump(const jump_polynomial &);
+
     // Equality comparable concept
     friend bool operator==(const mt19937_64 &, const mt19937_64 &);
     friend bool operator!=(const mt19937_64 &, const mt19937_64 &);
@@ -218,33 +238,43 @@ namespace trng {
     // Other useful methods
     static const char *name();
     long operator()(long);
+    template<typename iter>
+    void generate(iter, iter);
+    void generate(result_type *, std::size_t);
 
   private:
     parameter_type P;
     status_type S;
     static const char *const name_str;
+    // jumps shorter than this are carried out by generating the skipped numbers
+    static constexpr unsigned long long jump_threshold{1ull << 21u};
+
+    static const gf2_polynomial &characteristic_polynomial();
+
+    void generate_block();
+    static result_type temper(result_type);
   };
 
   // Inline and template methods
 
-  inline mt19937_64::result_type mt19937_64::operator()() {
+  inline void mt19937_64::generate_block() {
     const result_type mag01[2]{0u, 0xB5026F5AA96619E9u};
-    if (S.mti >= mt19937_64::N) {  // generate N words at one time
-      int i{0};
-      for (; i < mt19937_64::N - mt19937_64::M; ++i) {
-        const result_type x{(S.mt[i] & mt19937_64::UM) | (S.mt[i + 1] & mt19937_64::LM)};
-        S.mt[i] = S.mt[i + mt19937_64::M] ^ (x >> 1u) ^ mag01[static_cast<int>(x & 1u)];
-      }
-      for (; i < mt19937_64::N - 1; ++i) {
-        const result_type x{(S.mt[i] & mt19937_64::UM) | (S.mt[i + 1] & mt19937_64::LM)};
-        S.mt[i] = S.mt[i + (mt19937_64::M - mt19937_64::N)] ^ (x >> 1u) ^
-                  mag01[static_cast<int>(x & 1u)];
-      }
-      const result_type x{(S.mt[mt19937_64::N - 1] & UM) | (S.mt[0] & LM)};
-      S.mt[N - 1] = S.mt[mt19937_64::M - 1] ^ (x >> 1u) ^ mag01[static_cast<int>(x & 1u)];
-      S.mti = 0;
+    int i{0};
+    for (; i < mt19937_64::N - mt19937_64::M; ++i) {
+      const result_type x{(S.mt[i] & mt19937_64::UM) | (S.mt[i + 1] & mt19937_64::LM)};
+      S.mt[i] = S.mt[i + mt19937_64::M] ^ (x >> 1u) ^ mag01[static_cast<int>(x & 1u)];
     }
-    result_type x{S.mt[S.mti++]};
+    for (; i < mt19937_64::N - 1; ++i) {
+      const result_type x{(S.mt[i] & mt19937_64::UM) | (S.mt[i + 1] & mt19937_64::LM)};
+      S.mt[i] = S.mt[i + (mt19937_64::M - mt19937_64::N)] ^ (x >> 1u) ^
+                mag01[static_cast<int>(x & 1u)];
+    }
+    const result_type x{(S.mt[mt19937_64::N - 1] & UM) | (S.mt[0] & LM)};
+    S.mt[N - 1] = S.mt[mt19937_64::M - 1] ^ (x >> 1u) ^ mag01[static_cast<int>(x & 1u)];
+    S.mti = 0;
+  }
+
+  inline mt19937_64::result_type mt19937_64::temper(result_type x) {
     x ^= (x >> 29u) & 0x5555555555555555u;
     x ^= (x << 17u) & 0x71D67FFFEDA60000u;
     x ^= (x << 37u) & 0xFFF7EEE000000000u;
@@ -252,15 +282,42 @@ namespace trng {
     return x;
   }
 
-  inline void mt19937_64::discard(unsigned long long n) {
-    for (unsigned long long i{0}; i < n; ++i)
-      this->operator()();
+  inline mt19937_64::result_type mt19937_64::operator()() {
+    if (S.mti >= mt19937_64::N)  // generate N words at one time
+      generate_block();
+    return temper(S.mt[S.mti++]);
+  }
+
+  inline void mt19937_64::discard(unsigned long long n) { jump(n); }
+
+  inline void mt19937_64::jump(unsigned long long s) {
+    if (s < jump_threshold) {
+      for (unsigned long long i{0}; i < s; ++i)
+        this->operator()();
+    } else
+      jump(jump_polynomial(s));
   }
 
   inline long mt19937_64::operator()(long x) {
     return static_cast<long>(utility::uniformco<double, mt19937_64>(*this) * x);
   }
 
+  template<typename iter>
+  inline void mt19937_64::generate(iter first, iter last) {
+    while (first != last) {
+      if (S.mti >= N)
+        generate_block();
+      int i{S.mti};
+      for (; i < N and first != last; ++i, ++first)
+        *first = temper(S.mt[i]);
+      S.mti = i;
+    }
+  }
+
+  inline void mt19937_64::generate(result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
 }  // namespace trng
 
 #endif
@@ -138,6 +138,12 @@ namespace trng {
       negative_binomial_dist g(p);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      for (; first != last; ++first)
+        *first = (*this)(r);
+    }
     // property methods
     int min() const { return 0; }
     int max() const { return math::numeric_limits<int>::max(); }
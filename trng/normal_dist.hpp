@@ -55,6 +55,9 @@ namespace trng {
   public:
     using result_type = float_t;
 
+    // sampling methods, inversion of the cumulative density function is the default
+    enum class method_type { inversion, ziggurat };
+
     class param_type {
     private:
       result_type mu_{0}, sigma_{1};
@@ -116,26 +119,113 @@ namespace trng {
 
   private:
     param_type P;
+    method_type M{method_type::inversion};
+
+#if !(defined TRNG_CUDA)
+    // ziggurat with 128 layers of equal area, see
+    // J. A. Doornik, ``An Improved Ziggurat Method to Generate Normal Random Samples''
+    class ziggurat_table {
+    public:
+      static constexpr int layers{128};
+      // layer boundaries x[i] and ratios r[i] = x[i + 1] / x[i]
+      result_type x[layers + 1], r[layers];
+
+      ziggurat_table() {
+        const long double R{3.442619855899l}, V{9.91256303526217e-3l};
+        long double x_l[layers + 1];
+        long double f{math::exp(-R * R / 2)};
+        x_l[0] = V / f;
+        x_l[1] = R;
+        x_l[layers] = 0;
+        for (int i{2}; i < layers; ++i) {
+          x_l[i] = math::sqrt(-2 * math::ln(V / x_l[i - 1] + f));
+          f = math::exp(-x_l[i] * x_l[i] / 2);
+        }
+        for (int i{0}; i <= layers; ++i)
+          x[i] = static_cast<result_type>(x_l[i]);
+        for (int i{0}; i < layers; ++i)
+          r[i] = static_cast<result_type>(x_l[i + 1] / x_l[i]);
+      }
+    };
+
+    // the table is built once and shared by all instances
+    static const ziggurat_table &table() {
+      static const ziggurat_table T;
+      return T;
+    }
+
+    // standard normal variate by the ziggurat method
+    template<typename R>
+    static result_type ziggurat(R &r) {
+      const ziggurat_table &T{table()};
+      while (true) {
+        const result_type u{2 * utility::uniformco<result_type>(r) - 1};
+        const int i{static_cast<int>(utility::uniformco<result_type>(r) *
+                                     ziggurat_table::layers)};
+        // point within the rectangle of the layer's ziggurat core
+        if (math::abs(u) < T.r[i])
+          return u * T.x[i];
+        if (i == 0)
+          return ziggurat_tail(r, u < 0);
+        // point in the wedge, accept by comparing to the density
+        const result_type x{u * T.x[i]};
+        const result_type f0{math::exp((x * x - T.x[i] * T.x[i]) / 2)};
+        const result_type f1{math::exp((x * x - T.x[i + 1] * T.x[i + 1]) / 2)};
+        if (f1 + utility::uniformco<result_type>(r) * (f0 - f1) < 1)
+          return x;
+      }
+    }
+
+    // sample from the tail beyond the base layer, Marsaglia's method
+    template<typename R>
+    static result_type ziggurat_tail(R &r, bool negative) {
+      const result_type x_tail{table().x[1]};
+      result_type x, y;
+      do {
+        x = math::ln(utility::uniformoo<result_type>(r)) / x_tail;
+        y = math::ln(utility::uniformoo<result_type>(r));
+      } while (-2 * y < x * x);
+      return negative ? x - x_tail : x_tail - x;
+    }
+#endif
 
   public:
     // constructor
     TRNG_CUDA_ENABLE
-    explicit normal_dist(result_type mu, result_type sigma) : P{mu, sigma} {}
+    explicit normal_dist(result_type mu, result_type sigma,
+                         method_type M = method_type::inversion)
+        : P{mu, sigma}, M{M} {}
     TRNG_CUDA_ENABLE
-    explicit normal_dist(const param_type &P) : P{P} {}
+    explicit normal_dist(const param_type &P, method_type M = method_type::inversion)
+        : P{P}, M{M} {}
     // reset internal state
     TRNG_CUDA_ENABLE
     void reset() {}
     // random numbers
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
+#if !(defined TRNG_CUDA)
+      if (M == method_type::ziggurat)
+        return ziggurat(r) * P.sigma() + P.mu();
+#endif
       return icdf(utility::uniformoo<result_type>(r));
     }
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &P) {
-      normal_dist g(P);
+      normal_dist g(P, M);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      if (M == method_type::ziggurat) {
+        for (; first != last; ++first)
+          *first = (*this)(r);
+        return;
+      }
+      utility::generate_transformed<utility::u01_interval::oo, result_type>(
+          r, first, last, [this](result_type u) { return icdf(u); });
+    }
     // property methods
     TRNG_CUDA_ENABLE
     result_type min() const { return -math::numeric_limits<result_type>::infinity(); }
@@ -146,6 +236,13 @@ namespace trng {
     TRNG_CUDA_ENABLE
     void param(const param_type &P_new) { P = P_new; }
     TRNG_CUDA_ENABLE
+    method_type method() const { return M; }
+    TRNG_CUDA_ENABLE
+    void method(method_type M_new) { M = M_new; }
+    // the ziggurat method consumes a variable number of engine values per random number
+    TRNG_CUDA_ENABLE
+    bool variable_draws() const { return M == method_type::ziggurat; }
+    TRNG_CUDA_ENABLE
     result_type mu() const { return P.mu(); }
     TRNG_CUDA_ENABLE
     void mu(result_type mu_new) { P.mu(mu_new); }
@@ -178,13 +275,13 @@ namespace trng {
   template<typename float_t>
   TRNG_CUDA_ENABLE inline bool operator==(const normal_dist<float_t> &g1,
                                           const normal_dist<float_t> &g2) {
-    return g1.param() == g2.param();
+    return g1.param() == g2.param() and g1.method() == g2.method();
   }
 
   template<typename float_t>
   TRNG_CUDA_ENABLE inline bool operator!=(const normal_dist<float_t> &g1,
                                           const normal_dist<float_t> &g2) {
-    return g1.param() != g2.param();
+    return not(g1 == g2);
   }
 
   // Streamable concept
@@ -193,7 +290,10 @@ namespace trng {
                                                    const normal_dist<float_t> &g) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    out << "[normal " << g.param() << ']';
+    out << "[normal " << g.param();
+    if (g.method() == normal_dist<float_t>::method_type::ziggurat)
+      out << " ziggurat";
+    out << ']';
     out.flags(flags);
     return out;
   }
@@ -201,12 +301,21 @@ namespace trng {
   template<typename char_t, typename traits_t, typename float_t>
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
                                                    normal_dist<float_t> &g) {
+    using method_type = typename normal_dist<float_t>::method_type;
     typename normal_dist<float_t>::param_type p;
+    method_type m{method_type::inversion};
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    in >> utility::ignore_spaces() >> utility::delim("[normal ") >> p >> utility::delim(']');
-    if (in)
+    in >> utility::ignore_spaces() >> utility::delim("[normal ") >> p;
+    if (in and in.peek() == ' ') {
+      in >> utility::delim(" ziggurat");
+      m = method_type::ziggurat;
+    }
+    in >> utility::delim(']');
+    if (in) {
       g.param(p);
+      g.method(m);
+    }
     in.flags(flags);
     return in;
   }
@@ -0,0 +1,218 @@
+// Copyright (c) 2000-2026, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_PARALLEL_GENERATE_HPP)
+
+#define TRNG_PARALLEL_GENERATE_HPP
+
+#include <trng/utility.hpp>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if defined _MSC_VER && __cplusplus <= 201703
+#include <ciso646>
+#endif
+
+namespace trng {
+
+  // Execution policy of parallel_generate: number of threads (0 selects the number of
+  // hardware threads) and number of engine values that are consumed per generated value.
+  // The latter must be exact for the result to be independent of the number of threads, e.g.,
+  // utility::generate_canonical<double, 53> consumes two values of a 31-bit engine.
+  // Distributions whose sampling method consumes a variable number of engine values, e.g., by
+  // rejection, report this by variable_draws() and are generated sequentially.  Builds
+  // without NDEBUG verify the number of engine values and throw std::runtime_error if it is
+  // wrong.
+  //
+  // Cost model: thread i advances its copy of the engine by jump to the first value of its
+  // chunk, which takes O(log n) operations for engines with a jump method.  Engines without
+  // jump, e.g., minstd or lagfib2xor, discard by a loop and are used sequentially.
+  class parallel_policy {
+    unsigned int threads_;
+    unsigned long long draws_;
+
+  public:
+    explicit parallel_policy(unsigned int threads = 0, unsigned long long draws = 1)
+        : threads_{threads}, draws_{draws} {}
+
+    unsigned int threads() const {
+      if (threads_ > 0)
+        return threads_;
+      const unsigned int hardware_threads{std::thread::hardware_concurrency()};
+      return hardware_threads > 0 ? hardware_threads : 1;
+    }
+    unsigned long long draws() const { return draws_; }
+  };
+
+  namespace detail {
+
+    // true if d consumes a variable number of engine values per random number
+    template<typename dist>
+    auto variable_draws(const dist &d, int) -> decltype(d.variable_draws()) {
+      return d.variable_draws();
+    }
+
+    template<typename dist>
+    bool variable_draws(const dist &, long) {
+      return false;
+    }
+
+    // engines with a jump method, which advances the engine in sublinear time
+    template<typename R, typename = void>
+    struct has_jump : std::false_type {};
+
+    template<typename R>
+    struct has_jump<R, decltype(std::declval<R &>().jump(0ull), void())> : std::true_type {};
+
+    // minimal number of values per thread
+    constexpr std::ptrdiff_t parallel_generate_grain{4096};
+
+    // split [first, last) into contiguous chunks, chunk i is processed by a copy of R that has
+    // discarded as many values as the preceding chunks consume, R takes the state of the copy
+    // of the last chunk finally
+    template<typename iter, typename engine, typename function>
+    void parallel_chunks(const parallel_policy &policy, iter first, iter last, engine &R,
+                         function f) {
+      const std::ptrdiff_t n{std::distance(first, last)};
+      if (n <= 0)
+        return;
+      if (not has_jump<engine>::value) {
+        f(first, last, R);
+        return;
+      }
+      std::ptrdiff_t chunks{static_cast<std::ptrdiff_t>(policy.threads())};
+      if (chunks > n / parallel_generate_grain)
+        chunks = n / parallel_generate_grain;
+      if (chunks < 1)
+        chunks = 1;
+      const engine &R_0{R};
+      engine R_last(R_0);
+      std::vector<std::thread> threads;
+      std::vector<std::exception_ptr> errors(static_cast<std::size_t>(chunks));
+      auto chunk = [&](std::ptrdiff_t i) {
+        try {
+          const std::ptrdiff_t begin{n * i / chunks}, end{n * (i + 1) / chunks};
+          engine R_i(R_0);
+          R_i.discard(static_cast<unsigned long long>(begin) * policy.draws());
+          iter first_i{first}, last_i{first};
+          std::advance(first_i, begin);
+          std::advance(last_i, end);
+          f(first_i, last_i, R_i);
+          if (i + 1 == chunks)
+            R_last = R_i;
+        } catch (...) {
+          errors[static_cast<std::size_t>(i)] = std::current_exception();
+        }
+      };
+      try {
+        for (std::ptrdiff_t i{1}; i < chunks; ++i)
+          threads.emplace_back(chunk, i);
+      } catch (...) {
+        for (auto &t : threads)
+          t.join();
+        throw;
+      }
+      chunk(0);
+      for (auto &t : threads)
+        t.join();
+      for (auto &e : errors)
+        if (e)
+          std::rethrow_exception(e);
+#if !(defined NDEBUG)
+      engine R_n(R_0);
+      R_n.discard(static_cast<unsigned long long>(n) * policy.draws());
+      if (R_last != R_n)
+        utility::throw_this(std::runtime_error(
+            "wrong number of engine values per random number in trng::parallel_generate"));
+#endif
+      R = R_last;
+    }
+
+  }  // namespace detail
+
+  // Fill [first, last) with random numbers from the engine R or from the distribution d
+  // using several threads.  The result and the final state of R equal those of a sequential
+  // loop *first++ = d(R) if the policy specifies the number of engine values per random
+  // number correctly.  Each thread uses a copy of d, distributions that keep state from one
+  // random number to the next, e.g., correlated_normal_dist, are not supported.
+  template<typename iter, typename engine, typename dist>
+  void parallel_generate(const parallel_policy &policy, iter first, iter last, engine &R,
+                         const dist &d) {
+    if (detail::variable_draws(d, 0)) {
+      // chunks cannot be assigned to engine positions in advance
+      dist d_0(d);
+      for (; first != last; ++first)
+        *first = d_0(R);
+      return;
+    }
+    detail::parallel_chunks(policy, first, last, R,
+                            [&d](iter first_i, iter last_i, engine &R_i) {
+                              dist d_i(d);
+                              for (; first_i != last_i; ++first_i)
+                                *first_i = d_i(R_i);
+                            });
+  }
+
+  template<typename iter, typename engine>
+  void parallel_generate(const parallel_policy &policy, iter first, iter last, engine &R) {
+    detail::parallel_chunks(policy, first, last, R, [](iter first_i, iter last_i, engine &R_i) {
+      for (; first_i != last_i; ++first_i)
+        *first_i = R_i();
+    });
+  }
+
+  template<typename iter, typename engine, typename dist>
+  iter parallel_generate_n(const parallel_policy &policy, iter first, std::size_t n,
+                           engine &R, const dist &d) {
+    iter last{first};
+    std::advance(last, static_cast<typename std::iterator_traits<iter>::difference_type>(n));
+    parallel_generate(policy, first, last, R, d);
+    return last;
+  }
+
+  template<typename iter, typename engine>
+  iter parallel_generate_n(const parallel_policy &policy, iter first, std::size_t n,
+                           engine &R) {
+    iter last{first};
+    std::advance(last, static_cast<typename std::iterator_traits<iter>::difference_type>(n));
+    parallel_generate(policy, first, last, R);
+    return last;
+  }
+
+}  // namespace trng
+
+#endif
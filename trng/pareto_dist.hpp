@@ -135,6 +135,14 @@ namespace trng {
       pareto_dist g(p);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      utility::generate_transformed<utility::u01_interval::oo, result_type>(
+          r, first, last, [this](result_type u) {
+            return (math::pow(u, -1 / P.gamma()) - 1) * P.theta();
+          });
+    }
     // property methods
     TRNG_CUDA_ENABLE
     result_type min() const { return 0; }
@@ -0,0 +1,381 @@
+// Copyright (c) 2000-2026, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_PHILOX4X32_10_HPP)
+
+#define TRNG_PHILOX4X32_10_HPP
+
+#include <trng/trng_export.hpp>
+#include <trng/cuda.hpp>
+#include <trng/limits.hpp>
+#include <trng/utility.hpp>
+#include <trng/int_types.hpp>
+#include <trng/uint128.hpp>
+#include <trng/generate_canonical.hpp>
+#include <climits>
+#include <stdexcept>
+#include <ostream>
+#include <istream>
+#if defined _MSC_VER && __cplusplus <= 201703
+#include <ciso646>
+#endif
+
+namespace trng {
+
+  // Counter-based random number generator Philox4x32-10, see
+  //
+  // J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E. Shaw, ``Parallel random numbers: as
+  //   easy as 1, 2, 3'', Proceedings of 2011 International Conference for High Performance
+  //   Computing, Networking, Storage and Analysis, 2011.
+  //
+  // The i-th random number is word i mod 4 of the Philox block of the 128-bit counter i / 4.
+  // The status is the position of the next random number, the parameters are the key and
+  // the distance between consecutive positions.  Thus, jumps and splits are O(1).
+  class philox4x32_10 {
+  public:
+    // Uniform random number generator concept
+    using result_type = uint32_t;
+    TRNG_CUDA_ENABLE
+    result_type operator()();
+
+  private:
+    static constexpr result_type min_ = 0;
+    static constexpr result_type max_ = ~result_type(0);
+
+  public:
+    TRNG_CUDA_ENABLE
+    static constexpr result_type min() { return min_; }
+    TRNG_CUDA_ENABLE
+    static constexpr result_type max() { return max_; }
+
+  public:
+    // Parameter and status classes
+    class parameter_type {
+      result_type k0{0}, k1{0};
+      uint128 increment{1};
+
+    public:
+      parameter_type() = default;
+      explicit parameter_type(result_type k0, result_type k1) : k0{k0}, k1{k1} {}
+
+      friend class philox4x32_10;
+
+      // Equality comparable concept
+      friend bool operator==(const parameter_type &, const parameter_type &);
+      friend bool operator!=(const parameter_type &, const parameter_type &);
+
+      // Streamable concept
+      template<typename char_t, typename traits_t>
+      friend std::basic_ostream<char_t, traits_t> &operator<<(
+          std::basic_ostream<char_t, traits_t> &out, const parameter_type &P) {
+        std::ios_base::fmtflags flags(out.flags());
+        out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        out << '(' << P.k0 << ' ' << P.k1 << ' ' << P.increment << ')';
+        out.flags(flags);
+        return out;
+      }
+
+      template<typename char_t, typename traits_t>
+      friend std::basic_istream<char_t, traits_t> &operator>>(
+          std::basic_istream<char_t, traits_t> &in, parameter_type &P) {
+        parameter_type P_new;
+        std::ios_base::fmtflags flags(in.flags());
+        in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        in >> utility::delim('(') >> P_new.k0 >> utility::delim(' ') >> P_new.k1 >>
+            utility::delim(' ') >> P_new.increment >> utility::delim(')');
+        if (in)
+          P = P_new;
+        in.flags(flags);
+        return in;
+      }
+    };
+
+    class status_type {
+      uint128 r{0};
+
+    public:
+      status_type() = default;
+      explicit status_type(uint128 r) : r{r} {}
+
+      friend class philox4x32_10;
+
+      // Equality comparable concept
+      friend bool operator==(const status_type &, const status_type &);
+      friend bool operator!=(const status_type &, const status_type &);
+
+      // Streamable concept
+      template<typename char_t, typename traits_t>
+      friend std::basic_ostream<char_t, traits_t> &operator<<(
+          std::basic_ostream<char_t, traits_t> &out, const status_type &S) {
+        std::ios_base::fmtflags flags(out.flags());
+        out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        out << '(' << S.r << ')';
+        out.flags(flags);
+        return out;
+      }
+
+      template<typename char_t, typename traits_t>
+      friend std::basic_istream<char_t, traits_t> &operator>>(
+          std::basic_istream<char_t, traits_t> &in, status_type &S) {
+        status_type S_new;
+        std::ios_base::fmtflags flags(in.flags());
+        in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        in >> utility::delim('(') >> S_new.r >> utility::delim(')');
+        if (in)
+          S = S_new;
+        in.flags(flags);
+        return in;
+      }
+    };
+
+    static TRNG4_EXPORT const parameter_type Default;
+
+    // Random number engine concept
+    explicit philox4x32_10(parameter_type = Default);
+    explicit philox4x32_10(unsigned long, parameter_type = Default);
+    explicit philox4x32_10(unsigned long long, parameter_type = Default);
+
+    template<typename gen>
+    explicit philox4x32_10(gen &g, parameter_type P = Default) : P{P} {
+      seed(g);
+    }
+
+    void seed();
+    void seed(unsigned long);
+    template<typename gen>
+    void seed(gen &g) {
+      uint128 r{0};
+      for (int i{0}; i < 4; ++i) {
+        r <<= 32u;
+        r += uint128{static_cast<uint32_t>(g())};
+      }
+      S.r = r;
+    }
+    void seed(unsigned long long);
+
+    // Equality comparable concept
+    friend bool operator==(const philox4x32_10 &, const philox4x32_10 &);
+    friend bool operator!=(const philox4x32_10 &, const philox4x32_10 &);
+
+    // Streamable concept
+    template<typename char_t, typename traits_t>
+    friend std::basic_ostream<char_t, traits_t> &operator<<(
+        std::basic_ostream<char_t, traits_t> &out, const philox4x32_10 &R) {
+      std::ios_base::fmtflags flags(out.flags());
+      out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+      out << '[' << philox4x32_10::name() << ' ' << R.P << ' ' << R.S << ']';
+      out.flags(flags);
+      return out;
+    }
+
+    template<typename char_t, typename traits_t>
+    friend std::basic_istream<char_t, traits_t> &operator>>(
+        std::basic_istream<char_t, traits_t> &in, philox4x32_10 &R) {
+      philox4x32_10::parameter_type P_new;
+      philox4x32_10::status_type S_new;
+      std::ios_base::fmtflags flags(in.flags());
+      in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+      in >> utility::ignore_spaces();
+      in >> utility::delim('[') >> utility::delim(philox4x32_10::name()) >>
+          utility::delim(' ') >> P_new >> utility::delim(' ') >> S_new >> utility::delim(']');
+      if (in) {
+        R.P = P_new;
+        R.S = S_new;
+        R.block_valid = false;
+      }
+      in.flags(flags);
+      return in;
+    }
+
+    // Parallel random number generator concept
+    TRNG_CUDA_ENABLE
+    void split(unsigned int, unsigned int);
+    TRNG_CUDA_ENABLE
+    void jump2(unsigned int);
+    TRNG_CUDA_ENABLE
+    void jump(unsigned long long);
+    TRNG_CUDA_ENABLE
+    void discard(unsigned long long);
+
+    // Other useful methods
+    static const char *name();
+    TRNG_CUDA_ENABLE
+    long operator()(long);
+    template<typename iter>
+    TRNG_CUDA_ENABLE void generate(iter, iter);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
+    // random number that the (k + 1)-th call of operator() returns, state is not changed
+    TRNG_CUDA_ENABLE
+    result_type value_at(unsigned long long) const;
+    template<typename iter, typename out_iter>
+    TRNG_CUDA_ENABLE void values_at(iter, iter, out_iter) const;
+
+    // Philox blocks of lanes consecutive counters c, c + 1, ..., word j of block l is x[j][l]
+    template<int lanes>
+    TRNG_CUDA_ENABLE static void blocks(result_type k0, result_type k1, uint128 c,
+                                        result_type (&x)[4][lanes]);
+
+  private:
+    parameter_type P;
+    status_type S;
+    static const char *const name_str;
+
+    // most recently computed block, not part of the engine's state
+    uint128 block_counter{0};
+    result_type block[4]{};
+    bool block_valid{false};
+
+    // number of blocks that generate computes at once
+    static constexpr int generate_lanes{16};
+  };
+
+  // Inline and template methods
+
+  template<int lanes>
+  TRNG_CUDA_ENABLE inline void philox4x32_10::blocks(result_type k0, result_type k1,
+                                                     uint128 c, result_type (&x)[4][lanes]) {
+    for (int l{0}; l < lanes; ++l) {
+      const uint128 c_l{c + uint128{static_cast<uint64_t>(l)}};
+      x[0][l] = static_cast<result_type>(c_l.lo());
+      x[1][l] = static_cast<result_type>(c_l.lo() >> 32u);
+      x[2][l] = static_cast<result_type>(c_l.hi());
+      x[3][l] = static_cast<result_type>(c_l.hi() >> 32u);
+    }
+    // the lane loop has no dependencies, compilers vectorize the 32 x 32 -> 64 bit products
+    for (int round{0}; round < 10; ++round) {
+      if (round > 0) {
+        k0 += 0x9e3779b9u;
+        k1 += 0xbb67ae85u;
+      }
+      for (int l{0}; l < lanes; ++l) {
+        const uint64_t p0{static_cast<uint64_t>(0xd2511f53u) * x[0][l]};
+        const uint64_t p1{static_cast<uint64_t>(0xcd9e8d57u) * x[2][l]};
+        x[0][l] = static_cast<result_type>(p1 >> 32u) ^ x[1][l] ^ k0;
+        x[1][l] = static_cast<result_type>(p1);
+        x[2][l] = static_cast<result_type>(p0 >> 32u) ^ x[3][l] ^ k1;
+        x[3][l] = static_cast<result_type>(p0);
+      }
+    }
+  }
+
+  TRNG_CUDA_ENABLE
+  inline philox4x32_10::result_type philox4x32_10::operator()() {
+    const uint128 c{S.r >> 2};
+    if (not block_valid or c != block_counter) {
+      result_type x[4][1];
+      blocks<1>(P.k0, P.k1, c, x);
+      for (int j{0}; j < 4; ++j)
+        block[j] = x[j][0];
+      block_counter = c;
+      block_valid = true;
+    }
+    const result_type t{block[S.r.lo() & 3u]};
+    S.r += P.increment;
+    return t;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline long philox4x32_10::operator()(long x) {
+    return static_cast<long>(utility::uniformco<double, philox4x32_10>(*this) * x);
+  }
+
+  template<typename iter>
+  TRNG_CUDA_ENABLE inline void philox4x32_10::generate(iter first, iter last) {
+    if (P.increment != uint128{1}) {
+      for (; first != last; ++first)
+        *first = (*this)();
+      return;
+    }
+    // complete the current block, then compute several blocks at once
+    for (; first != last and (S.r.lo() & 3u) != 0; ++first)
+      *first = (*this)();
+    result_type x[4][generate_lanes];
+    while (first != last) {
+      blocks<generate_lanes>(P.k0, P.k1, S.r >> 2, x);
+      uint64_t n{0};
+      for (int l{0}; l < generate_lanes and first != last; ++l)
+        for (int j{0}; j < 4 and first != last; ++j, ++n, ++first)
+          *first = x[j][l];
+      S.r += uint128{n};
+    }
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32_10::generate(result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
+  TRNG_CUDA_ENABLE
+  inline philox4x32_10::result_type philox4x32_10::value_at(unsigned long long k) const {
+    const uint128 r{S.r + uint128{k} * P.increment};
+    result_type x[4][1];
+    blocks<1>(P.k0, P.k1, r >> 2, x);
+    return x[r.lo() & 3u][0];
+  }
+
+  template<typename iter, typename out_iter>
+  TRNG_CUDA_ENABLE inline void philox4x32_10::values_at(iter first, iter last,
+                                                        out_iter out) const {
+    for (; first != last; ++first, ++out)
+      *out = value_at(*first);
+  }
+
+  // Parallel random number generator concept
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32_10::split(unsigned int s, unsigned int n) {
+#if !(defined TRNG_CUDA)
+    if (s < 1 or n >= s)
+      utility::throw_this(
+          std::invalid_argument("invalid argument for trng::philox4x32_10::split"));
+#endif
+    S.r += uint128{n} * P.increment;
+    P.increment *= uint128{s};
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32_10::jump2(unsigned int s) {
+    S.r += (uint128{1} << static_cast<int>(s % 128)) * P.increment;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32_10::jump(unsigned long long s) {
+    S.r += uint128{s} * P.increment;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void philox4x32_10::discard(unsigned long long n) { jump(n); }
+
+}  // namespace trng
+
+#endif
@@ -54,13 +54,33 @@ namespace trng {
   public:
     using result_type = int;
 
+    // sampling methods, inversion of the cumulative density function is the default
+    enum class method_type { inversion, ptrs };
+
+    // smallest mean for which the PTRS method is applied, inversion is used otherwise
+    static constexpr double ptrs_mu_min{10};
+
     class param_type {
     private:
       double mu_{0};
+      method_type M_{method_type::inversion};
       std::vector<double> P_;
+      // constants of the PTRS method
+      double log_mu_{0}, a_{0}, b_{0}, ln_inv_alpha_{0}, v_r_{0};
+
+      bool ptrs() const { return M_ == method_type::ptrs and mu_ >= ptrs_mu_min; }
 
       void calc_probabilities() {
         P_ = std::vector<double>();
+        if (ptrs()) {
+          // setup costs and memory are independent of mu for the PTRS method
+          log_mu_ = math::ln(mu_);
+          b_ = 0.931 + 2.53 * math::sqrt(mu_);
+          a_ = -0.059 + 0.02483 * b_;
+          ln_inv_alpha_ = math::ln(1.1239 + 1.1328 / (b_ - 3.4));
+          v_r_ = 0.9277 - 3.6224 / (b_ - 2);
+          return;
+        }
         int x = 0;
         while (x < 7 or x < 2 * mu_) {
           P_.push_back(math::GammaQ(x + 1.0, mu_));
@@ -75,23 +95,53 @@ namespace trng {
         mu_ = mu_new;
         calc_probabilities();
       }
+      method_type method() const { return M_; }
+      void method(method_type M_new) {
+        M_ = M_new;
+        calc_probabilities();
+      }
       param_type() = default;
-      explicit param_type(double mu) : mu_{mu} { calc_probabilities(); }
+      explicit param_type(double mu, method_type M = method_type::inversion) : mu_{mu}, M_{M} {
+        calc_probabilities();
+      }
       friend class poisson_dist;
     };
 
   private:
     param_type P;
 
+    // W. Hoermann, ``The transformed rejection method for generating Poisson random
+    // variables'', Insurance: Mathematics and Economics 12 (1993) 39--45
+    template<typename R>
+    int ptrs(R &r) const {
+      while (true) {
+        const double u{utility::uniformco<double>(r) - 0.5};
+        const double v{utility::uniformoo<double>(r)};
+        const double us{0.5 - math::abs(u)};
+        const double k{math::floor((2 * P.a_ / us + P.b_) * u + P.mu_ + 0.43)};
+        if (k < 0 or k > math::numeric_limits<int>::max())
+          continue;
+        if (us >= 0.07 and v <= P.v_r_)
+          return static_cast<int>(k);
+        if (us < 0.013 and v > us)
+          continue;
+        if (math::ln(v) + P.ln_inv_alpha_ - math::ln(P.a_ / (us * us) + P.b_) <=
+            -P.mu_ + k * P.log_mu_ - math::ln_Gamma(k + 1))
+          return static_cast<int>(k);
+      }
+    }
+
   public:
     // constructor
-    explicit poisson_dist(double mu) : P{mu} {}
+    explicit poisson_dist(double mu, method_type M = method_type::inversion) : P{mu, M} {}
     explicit poisson_dist(const param_type &P) : P{P} {}
     // reset internal state
     void reset() {}
     // random numbers
     template<typename R>
     int operator()(R &r) {
+      if (P.ptrs())
+        return ptrs(r);
       double p{utility::uniformco<double>(r)};
       const std::size_t x{utility::discrete(p, P.P_.begin(), P.P_.end())};
       int x_i{static_cast<int>(x)};
@@ -109,11 +159,21 @@ namespace trng {
       poisson_dist g(p);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      for (; first != last; ++first)
+        *first = (*this)(r);
+    }
     // property methods
     int min() const { return 0; }
     int max() const { return math::numeric_limits<int>::max(); }
     const param_type &param() const { return P; }
     void param(const param_type &P_new) { P = P_new; }
+    method_type method() const { return P.method(); }
+    void method(method_type M_new) { P.method(M_new); }
+    // rejections of the PTRS method consume additional engine values
+    bool variable_draws() const { return P.ptrs(); }
     double mu() const { return P.mu(); }
     void mu(double mu_new) { P.mu(mu_new); }
     // probability density function
@@ -127,10 +187,12 @@ namespace trng {
   // -------------------------------------------------------------------
 
   // EqualityComparable concept
-  bool operator==(const poisson_dist::param_type &P1, const poisson_dist::param_type &P2) {
-    return P1.mu() == P2.mu();
+  inline bool operator==(const poisson_dist::param_type &P1,
+                         const poisson_dist::param_type &P2) {
+    return P1.mu() == P2.mu() and P1.method() == P2.method();
   }
-  bool operator!=(const poisson_dist::param_type &P1, const poisson_dist::param_type &P2) {
+  inline bool operator!=(const poisson_dist::param_type &P1,
+                         const poisson_dist::param_type &P2) {
     return not(P1 == P2);
   }
 
@@ -140,8 +202,10 @@ namespace trng {
                                                    const poisson_dist::param_type &P) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    out << '(' << std::setprecision(math::numeric_limits<double>::digits10 + 1) << P.mu()
-        << ')';
+    out << '(' << std::setprecision(math::numeric_limits<double>::digits10 + 1) << P.mu();
+    if (P.method() == poisson_dist::method_type::ptrs)
+      out << " ptrs";
+    out << ')';
     out.flags(flags);
     return out;
   }
@@ -150,11 +214,17 @@ namespace trng {
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
                                                    poisson_dist::param_type &P) {
     double mu;
+    poisson_dist::method_type m{poisson_dist::method_type::inversion};
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    in >> utility::delim('(') >> mu >> utility::delim(')');
+    in >> utility::delim('(') >> mu;
+    if (in and in.peek() == ' ') {
+      in >> utility::delim(" ptrs");
+      m = poisson_dist::method_type::ptrs;
+    }
+    in >> utility::delim(')');
     if (in)
-      P = poisson_dist::param_type(mu);
+      P = poisson_dist::param_type(mu, m);
     in.flags(flags);
     return in;
   }
@@ -162,11 +232,11 @@ namespace trng {
   // -------------------------------------------------------------------
 
   // EqualityComparable concept
-  bool operator==(const poisson_dist &g1, const poisson_dist &g2) {
+  inline bool operator==(const poisson_dist &g1, const poisson_dist &g2) {
     return g1.param() == g2.param();
   }
-  bool operator!=(const poisson_dist &g1, const poisson_dist &g2) {
-    return g1.param() != g2.param();
+  inline bool operator!=(const poisson_dist &g1, const poisson_dist &g2) {
+    return not(g1 == g2);
   }
 
   // Streamable concept
@@ -183,12 +253,19 @@ namespace trng {
   template<typename char_t, typename traits_t>
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
                                                    poisson_dist &g) {
-    poisson_dist::param_type P;
+    double mu;
+    poisson_dist::method_type m{poisson_dist::method_type::inversion};
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    in >> utility::ignore_spaces() >> utility::delim("[poisson ") >> P >> utility::delim(']');
+    // parameters are read directly to avoid building the inversion table needlessly
+    in >> utility::ignore_spaces() >> utility::delim("[poisson ") >> utility::delim('(') >> mu;
+    if (in and in.peek() == ' ') {
+      in >> utility::delim(" ptrs");
+      m = poisson_dist::method_type::ptrs;
+    }
+    in >> utility::delim(")]");
     if (in)
-      g.param(P);
+      g.param(poisson_dist::param_type(mu, m));
     in.flags(flags);
     return in;
   }
@@ -135,6 +135,14 @@ namespace trng {
       powerlaw_dist g(p);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      utility::generate_transformed<utility::u01_interval::oc, result_type>(
+          r, first, last, [this](result_type u) {
+            return P.theta() * math::pow(u, -1 / P.gamma());
+          });
+    }
     // property methods
     TRNG_CUDA_ENABLE
     result_type min() const { return P.theta(); }
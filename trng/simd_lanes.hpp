@@ -0,0 +1,207 @@
+// Copyright (c) 2000-2026, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_SIMD_LANES_HPP)
+
+#define TRNG_SIMD_LANES_HPP
+
+#include <trng/int_types.hpp>
+#include <trng/int_math.hpp>
+#include <trng/utility.hpp>
+#include <trng/mrg_parameter.hpp>
+#include <trng/mrg_status.hpp>
+#include <cstddef>
+#if defined _MSC_VER && __cplusplus <= 201703
+#include <ciso646>
+#endif
+
+namespace trng {
+
+  // Engine adaptor that runs a multiple recursive generator (mrg2, ..., mrg5s, yarn2, ...,
+  // yarn5s) in several leapfrogged lanes.  Lane i is a copy of the base engine split via
+  // split(lanes, i), the outputs of the lanes are interleaved.  Thus, the adaptor yields
+  // exactly the same sequence as the base engine.  Lane states are held in
+  // structure-of-arrays layout, such that the lane loop in step_lanes may be vectorized by
+  // the compiler (e.g., with AVX2 or AVX-512 enabled).
+  template<typename engine_t, int lanes>
+  class simd_lanes {
+    static_assert(lanes > 0, "number of lanes must be positive");
+
+  public:
+    using engine_type = engine_t;
+    // Uniform random number generator concept
+    using result_type = typename engine_type::result_type;
+    result_type operator()() {
+      if (index >= lanes)
+        refill();
+      return buffer[index++];
+    }
+    static constexpr result_type min() { return engine_type::min(); }
+    static constexpr result_type max() { return engine_type::max(); }
+
+    // Random number engine concept
+    explicit simd_lanes(const engine_type &R = engine_type()) {
+      for (int l{0}; l < lanes; ++l) {
+        R_lane[l] = R;
+        R_lane[l].split(lanes, l);
+      }
+    }
+
+    void discard(unsigned long long n) {
+      while (n > 0 and index < lanes) {
+        ++index;
+        --n;
+      }
+      if (n == 0)
+        return;
+      if (n >= lanes)
+        for (int l{0}; l < lanes; ++l)
+          R_lane[l].jump(n / lanes);
+      n %= lanes;
+      if (n > 0) {
+        refill();
+        index = static_cast<int>(n);
+      }
+    }
+
+    // Equality comparable concept
+    friend bool operator==(const simd_lanes &R1, const simd_lanes &R2) {
+      for (int l{0}; l < lanes; ++l)
+        if (R1.R_lane[l] != R2.R_lane[l])
+          return false;
+      if (R1.index != R2.index)
+        return false;
+      for (int l{R1.index}; l < lanes; ++l)
+        if (R1.buffer[l] != R2.buffer[l])
+          return false;
+      return true;
+    }
+
+    friend bool operator!=(const simd_lanes &R1, const simd_lanes &R2) { return not(R1 == R2); }
+
+    // Other useful methods
+    static constexpr int size() { return lanes; }
+    const engine_type &lane(int l) const { return R_lane[l]; }
+    long operator()(long x) {
+      return static_cast<long>(utility::uniformco<double, simd_lanes>(*this) * x);
+    }
+    template<typename iter>
+    void generate(iter first, iter last) {
+      for (; index < lanes and first != last; ++first)
+        *first = buffer[index++];
+      if (first == last)
+        return;
+      // work on local copies of the lane states, which do not alias the output range
+      result_type a[order][lanes], r[order][lanes], y[lanes];
+      load_lanes(a, r);
+      int l{0};
+      while (first != last) {
+        step_lanes(a, r, y);
+        for (l = 0; l < lanes and first != last; ++l, ++first)
+          *first = y[l];
+      }
+      store_lanes(r);
+      for (int k{0}; k < lanes; ++k)
+        buffer[k] = y[k];
+      index = l;
+    }
+    void generate(result_type *first, std::size_t n) { generate(first, first + n); }
+
+  private:
+    template<typename T>
+    struct order_of;
+
+    template<typename T, int n, typename F>
+    struct order_of<mrg_parameter<T, n, F>> {
+      static constexpr int value{n};
+    };
+
+    static constexpr int order{order_of<typename engine_type::parameter_type>::value};
+    static constexpr result_type modulus{engine_type::modulus};
+
+    engine_type R_lane[lanes];
+    result_type buffer[lanes]{};
+    int index{lanes};
+
+    // yarn generators map the internal state onto their output via a power table
+    template<typename R>
+    static auto output(const R *, result_type x) -> decltype(R::g(x)) {
+      return x == 0 ? 0 : R::g(x);
+    }
+    static result_type output(const void *, result_type x) { return x; }
+
+    void load_lanes(result_type (&a)[order][lanes], result_type (&r)[order][lanes]) const {
+      for (int k{0}; k < order; ++k)
+        for (int l{0}; l < lanes; ++l) {
+          a[k][l] = R_lane[l].P.a[k];
+          r[k][l] = R_lane[l].S.r[k];
+        }
+    }
+
+    void store_lanes(const result_type (&r)[order][lanes]) {
+      for (int k{0}; k < order; ++k)
+        for (int l{0}; l < lanes; ++l)
+          R_lane[l].S.r[k] = r[k][l];
+    }
+
+    void refill() {
+      result_type a[order][lanes], r[order][lanes];
+      load_lanes(a, r);
+      step_lanes(a, r, buffer);
+      store_lanes(r);
+      index = 0;
+    }
+
+    // advance all lanes by one step
+    static void step_lanes(const result_type (&a)[order][lanes], result_type (&r)[order][lanes],
+                           result_type (&y)[lanes]) {
+      for (int l{0}; l < lanes; ++l) {
+        uint64_t t{0};
+        for (int k{0}; k < order and k < 4; ++k)
+          t += static_cast<uint64_t>(a[k][l]) * static_cast<uint64_t>(r[k][l]);
+        for (int k{4}; k < order; ++k) {
+          if (t >= static_cast<uint64_t>(2u) * modulus * modulus)
+            t -= static_cast<uint64_t>(2u) * modulus * modulus;
+          t += static_cast<uint64_t>(a[k][l]) * static_cast<uint64_t>(r[k][l]);
+        }
+        for (int k{order - 1}; k > 0; --k)
+          r[k][l] = r[k - 1][l];
+        r[0][l] = int_math::modulo<modulus, order>(t);
+      }
+      for (int l{0}; l < lanes; ++l)
+        y[l] = output(static_cast<const engine_type *>(nullptr), r[0][l]);
+    }
+  };
+
+}  // namespace trng
+
+#endif
@@ -0,0 +1,520 @@
+// Copyright (c) 2000-2026, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_SIMD_MATH_HPP)
+
+#define TRNG_SIMD_MATH_HPP
+
+#include <trng/int_types.hpp>
+#include <trng/limits.hpp>
+#include <trng/math.hpp>
+#include <trng/constants.hpp>
+#include <trng/special_functions.hpp>
+#include <cstddef>
+#include <cstring>
+#if defined _MSC_VER && __cplusplus <= 201703
+#include <ciso646>
+#endif
+
+// the element kernels must be inlined into the element loops to be vectorized, but they
+// exceed the inlining limits of common compilers
+#if defined __GNUC__
+#define TRNG_SIMD_INLINE inline __attribute__((always_inline))
+#elif defined _MSC_VER
+#define TRNG_SIMD_INLINE __forceinline
+#else
+#define TRNG_SIMD_INLINE inline
+#endif
+
+namespace trng {
+
+  namespace math {
+
+    // Array versions of ln, exp, erf, erfc, Phi and inv_Phi for float and double.  Each
+    // element is computed by a branch-free kernel, all regions of an approximation are
+    // evaluated and the result is blended by selects, and bit manipulations are done on
+    // integers of the same width as the floating point type.  Thus, the element loops may be
+    // vectorized by the compiler for the enabled instruction set (e.g., SSE2, AVX2 or
+    // AVX-512, double precision needs 64-bit integer comparison masks, i.e., SSE4.2 at
+    // least), and run as ordinary scalar code otherwise.  Results agree with the scalar
+    // functions up to a few units in the last place.  The output range may coincide with
+    // the input range.
+
+    namespace detail {
+
+      template<typename T>
+      struct simd_math_traits;
+
+      template<>
+      struct simd_math_traits<float> {
+        using uint_type = uint32_t;
+        static constexpr int mantissa_bits = 23;
+        static constexpr uint_type exponent_bias = 127;
+        static constexpr uint_type mantissa_mask = 0x007fffffu;
+        // clears the lower mantissa bits, such that the square of the remaining part is exact
+        static constexpr uint_type split_mask = 0xfffff000u;
+        // 1.5 * 2^23, adding and subtracting it rounds to the nearest integer
+        static constexpr float round_magic = 12582912.0f;
+        // 2^25, scales subnormal numbers into the range of normal numbers
+        static constexpr float subnormal_scale = 33554432.0f;
+        static constexpr float exp_min = -104.0f;
+        static constexpr float exp_max = 89.0f;
+        static constexpr uint_type rsqrt_magic = 0x5f3759dfu;
+        static constexpr float log2_e = 1.44269504088896340736f;
+        static constexpr float ln_2_hi = 0.693145751953125f;
+        static constexpr float ln_2_lo = 1.42860682030941723212e-06f;
+        // number of terms of the polynomials for exp, ln, erf and erfc
+        static constexpr int exp_terms = 8;
+        static constexpr int ln_terms = 4;
+        static constexpr int erf_terms = 7;
+        static constexpr int erfc_terms = 25;
+      };
+
+      template<>
+      struct simd_math_traits<double> {
+        using uint_type = uint64_t;
+        static constexpr int mantissa_bits = 52;
+        static constexpr uint_type exponent_bias = 1023;
+        static constexpr uint_type mantissa_mask = 0x000fffffffffffffu;
+        // clears the lower mantissa bits, such that the square of the remaining part is exact
+        static constexpr uint_type split_mask = 0xfffffffff8000000u;
+        // 1.5 * 2^52, adding and subtracting it rounds to the nearest integer
+        static constexpr double round_magic = 6755399441055744.0;
+        // 2^54, scales subnormal numbers into the range of normal numbers
+        static constexpr double subnormal_scale = 18014398509481984.0;
+        static constexpr double exp_min = -746.0;
+        static constexpr double exp_max = 710.0;
+        static constexpr uint_type rsqrt_magic = 0x5fe6eb50c7b537a9u;
+        static constexpr double log2_e = 1.44269504088896340736;
+        static constexpr double ln_2_hi = 6.93147180369123816490e-01;
+        static constexpr double ln_2_lo = 1.90821492927058770002e-10;
+        // number of terms of the polynomials for exp, ln, erf and erfc
+        static constexpr int exp_terms = 14;
+        static constexpr int ln_terms = 10;
+        static constexpr int erf_terms = 14;
+        static constexpr int erfc_terms = 25;
+      };
+
+      // polynomial coefficients, shared by float and double
+      template<typename T>
+      struct simd_math_coefficients {
+        // 1 / k!
+        static constexpr T exp[14]{static_cast<T>(1.0l),
+                                   static_cast<T>(1.0l),
+                                   static_cast<T>(1.0l / 2),
+                                   static_cast<T>(1.0l / 6),
+                                   static_cast<T>(1.0l / 24),
+                                   static_cast<T>(1.0l / 120),
+                                   static_cast<T>(1.0l / 720),
+                                   static_cast<T>(1.0l / 5040),
+                                   static_cast<T>(1.0l / 40320),
+                                   static_cast<T>(1.0l / 362880),
+                                   static_cast<T>(1.0l / 3628800),
+                                   static_cast<T>(1.0l / 39916800),
+                                   static_cast<T>(1.0l / 479001600),
+                                   static_cast<T>(1.0l / 6227020800)};
+        // 1 / (2k + 3), ln(m) = 2f (1 + f^2 / 3 + f^4 / 5 + ...) with f = (m - 1) / (m + 1)
+        static constexpr T ln[10]{static_cast<T>(1.0l / 3),  static_cast<T>(1.0l / 5),
+                                  static_cast<T>(1.0l / 7),  static_cast<T>(1.0l / 9),
+                                  static_cast<T>(1.0l / 11), static_cast<T>(1.0l / 13),
+                                  static_cast<T>(1.0l / 15), static_cast<T>(1.0l / 17),
+                                  static_cast<T>(1.0l / 19), static_cast<T>(1.0l / 21)};
+        // Taylor series of erf(x) / x in x^2, used for |x| < 1/2
+        static constexpr T erf[14]{
+            static_cast<T>(1.12837916709551256e+00l),  static_cast<T>(-3.76126389031837538e-01l),
+            static_cast<T>(1.12837916709551261e-01l),  static_cast<T>(-2.68661706451312522e-02l),
+            static_cast<T>(5.22397762544218793e-03l),  static_cast<T>(-8.54832702345085333e-04l),
+            static_cast<T>(1.20553329817896636e-04l),  static_cast<T>(-1.49256503584062504e-05l),
+            static_cast<T>(1.64621143658892485e-06l),  static_cast<T>(-1.63658446912349245e-07l),
+            static_cast<T>(1.48071928158792176e-08l),  static_cast<T>(-1.22905553017179284e-09l),
+            static_cast<T>(9.42275906465041125e-11l),  static_cast<T>(-6.71136685516411048e-12l)};
+        // polynomials in u in [-1, 1] approximating h(t) = exp(x^2) x erfc(x) with t = 1 / x
+        // for t in [1/2, 2] (erfc_near) and for t in [2/55, 1/2] (erfc_far), power form of
+        // Chebyshev series of degree 24
+        static constexpr T erfc_near[25]{
+            static_cast<T>(3.91280471378491812e-01l),  static_cast<T>(-1.01974084681100446e-01l),
+            static_cast<T>(2.06659804386052602e-02l),  static_cast<T>(-1.21060673686757317e-03l),
+            static_cast<T>(-1.81795817136740177e-03l), static_cast<T>(1.39574259157456857e-03l),
+            static_cast<T>(-7.10430967004128206e-04l), static_cast<T>(2.95139190084399265e-04l),
+            static_cast<T>(-1.02035414677844181e-04l), static_cast<T>(2.65902192465698851e-05l),
+            static_cast<T>(-2.20892917517562656e-06l), static_cast<T>(-3.31396070047292487e-06l),
+            static_cast<T>(3.18178908144976673e-06l),  static_cast<T>(-2.00815536943782189e-06l),
+            static_cast<T>(1.05192455823911251e-06l),  static_cast<T>(-4.78331980959814754e-07l),
+            static_cast<T>(1.97718438464572820e-07l),  static_cast<T>(-8.02219505782736870e-08l),
+            static_cast<T>(1.96508730878936684e-08l),  static_cast<T>(9.88130787813470952e-09l),
+            static_cast<T>(-5.11196573091053548e-09l), static_cast<T>(-3.71282343780799539e-09l),
+            static_cast<T>(-6.38453086321641466e-10l), static_cast<T>(3.65630520088079916e-09l),
+            static_cast<T>(-1.30866770439344438e-09l)};
+        static constexpr T erfc_far[25]{
+            static_cast<T>(5.45771917383118255e-01l),  static_cast<T>(-2.90540899671228939e-02l),
+            static_cast<T>(-8.37716467089240184e-03l), static_cast<T>(2.69858626265664014e-03l),
+            static_cast<T>(-1.46910294065161179e-04l), static_cast<T>(-1.53186627325270757e-04l),
+            static_cast<T>(6.09628817052874182e-05l),  static_cast<T>(-6.62333689784014073e-06l),
+            static_cast<T>(-4.02741052093065947e-06l), static_cast<T>(2.44924494350942241e-06l),
+            static_cast<T>(-5.68930552793564142e-07l), static_cast<T>(-6.72660620327295002e-08l),
+            static_cast<T>(1.14822378827736162e-07l),  static_cast<T>(-4.85395746130541177e-08l),
+            static_cast<T>(7.59636535785039614e-09l),  static_cast<T>(3.83047819703062140e-09l),
+            static_cast<T>(-3.46789050428243135e-09l), static_cast<T>(1.36346639678944501e-09l),
+            static_cast<T>(-2.05075746400822144e-10l), static_cast<T>(-1.43792359375604105e-10l),
+            static_cast<T>(1.50594968120322253e-10l),  static_cast<T>(-6.06501967288686089e-11l),
+            static_cast<T>(-3.10245682699265535e-12l), static_cast<T>(1.19327393275519264e-11l),
+            static_cast<T>(-3.10356674527507004e-12l)};
+      };
+
+      template<typename T>
+      constexpr T simd_math_coefficients<T>::exp[14];
+
+      template<typename T>
+      constexpr T simd_math_coefficients<T>::ln[10];
+
+      template<typename T>
+      constexpr T simd_math_coefficients<T>::erf[14];
+
+      template<typename T>
+      constexpr T simd_math_coefficients<T>::erfc_near[25];
+
+      template<typename T>
+      constexpr T simd_math_coefficients<T>::erfc_far[25];
+
+      // ---------------------------------------------------------------
+
+      template<typename T>
+      TRNG_SIMD_INLINE typename simd_math_traits<T>::uint_type simd_to_bits(T x) {
+        typename simd_math_traits<T>::uint_type b;
+        std::memcpy(&b, &x, sizeof(b));
+        return b;
+      }
+
+      template<typename T>
+      TRNG_SIMD_INLINE T simd_from_bits(typename simd_math_traits<T>::uint_type b) {
+        T x;
+        std::memcpy(&x, &b, sizeof(x));
+        return x;
+      }
+
+      // branch-free selection of a if c is true and of b otherwise, both arguments are used
+      // unconditionally, thus the compiler does not move their computation into a branch,
+      // which could not be if-converted as long as floating point exceptions are observable
+      template<typename T>
+      TRNG_SIMD_INLINE T simd_select(bool c, T a, T b) {
+        using uint_type = typename simd_math_traits<T>::uint_type;
+        const uint_type mask{c ? ~uint_type(0) : uint_type(0)};
+        return simd_from_bits<T>((simd_to_bits(a) & mask) | (simd_to_bits(b) & ~mask));
+      }
+
+      // 2^n for an integral valued n + round_magic, n in the range of normal exponents
+      template<typename T>
+      TRNG_SIMD_INLINE T simd_pow2(T n_plus_magic) {
+        using traits = simd_math_traits<T>;
+        const T magic{traits::round_magic};
+        return simd_from_bits<T>(
+            (simd_to_bits(n_plus_magic) - simd_to_bits(magic) + traits::exponent_bias)
+            << traits::mantissa_bits);
+      }
+
+      // polynomial c[0] + c[1] x + ... + c[terms - 1] x^(terms - 1) by Horner's method,
+      // unrolled at compile time such that element loops contain no inner loops
+      template<int terms>
+      struct simd_polynomial {
+        template<typename T>
+        TRNG_SIMD_INLINE static T horner(const T *c, T x) {
+          return c[0] + x * simd_polynomial<terms - 1>::horner(c + 1, x);
+        }
+      };
+
+      template<>
+      struct simd_polynomial<1> {
+        template<typename T>
+        TRNG_SIMD_INLINE static T horner(const T *c, T) {
+          return c[0];
+        }
+      };
+
+      // polynomial with coefficients selected from c_1 or c_2, selecting between constants
+      // needs no integer masks
+      template<int terms>
+      struct simd_blended_polynomial {
+        template<typename T>
+        TRNG_SIMD_INLINE static T horner(const T *c_1, const T *c_2, bool first, T x) {
+          return (first ? c_1[0] : c_2[0]) +
+                 x * simd_blended_polynomial<terms - 1>::horner(c_1 + 1, c_2 + 1, first, x);
+        }
+      };
+
+      template<>
+      struct simd_blended_polynomial<1> {
+        template<typename T>
+        TRNG_SIMD_INLINE static T horner(const T *c_1, const T *c_2, bool first, T) {
+          return first ? c_1[0] : c_2[0];
+        }
+      };
+
+      // ---------------------------------------------------------------
+
+      // exp(x + dx) for a small correction dx, which is added after the argument reduction
+      template<typename T>
+      TRNG_SIMD_INLINE T simd_exp(T x, T dx) {
+        using traits = simd_math_traits<T>;
+        using coeffs = simd_math_coefficients<T>;
+        const T magic{traits::round_magic};
+        // clamping also maps NaN to a finite value, results beyond the limits are 0 or
+        // infinity
+        T y{simd_select(x > traits::exp_min, x, T(traits::exp_min))};
+        y = simd_select(y < traits::exp_max, y, T(traits::exp_max));
+        // x = n ln 2 + r with |r| <= ln(2) / 2
+        const T n_magic{y * traits::log2_e + magic};
+        const T n{n_magic - magic};
+        const T r{((y - n * traits::ln_2_hi) + dx) - n * traits::ln_2_lo};
+        // 2^n = 2^n1 2^n2, with n1 and n2 in the range of normal exponents
+        const T n1_magic{n * constants<T>::one_half + magic};
+        const T n2_magic{(n - (n1_magic - magic)) + magic};
+        y = simd_polynomial<traits::exp_terms>::horner(coeffs::exp, r) * simd_pow2(n1_magic) *
+            simd_pow2(n2_magic);
+        return simd_select(x == x, y, x);
+      }
+
+      template<typename T>
+      TRNG_SIMD_INLINE T simd_exp(T x) {
+        return simd_exp(x, T(0));
+      }
+
+      template<typename T>
+      TRNG_SIMD_INLINE T simd_ln(T x) {
+        using traits = simd_math_traits<T>;
+        using coeffs = simd_math_coefficients<T>;
+        using uint_type = typename traits::uint_type;
+        const T magic{traits::round_magic};
+        const bool subnormal{x < numeric_limits<T>::min()};
+        const uint_type b{
+            simd_to_bits(simd_select(subnormal, x * traits::subnormal_scale, x))};
+        // x = 2^e m with m in [1/sqrt(2), sqrt(2))
+        T m{simd_from_bits<T>((b & traits::mantissa_mask) | simd_to_bits(T(1)))};
+        T e{simd_from_bits<T>(simd_to_bits(magic) + (b >> traits::mantissa_bits)) -
+            (magic + T(traits::exponent_bias))};
+        e = simd_select(subnormal, e - T(traits::mantissa_bits + 2), e);
+        const bool large{m > constants<T>::sqrt_2};
+        m = simd_select(large, m * constants<T>::one_half, m);
+        e = simd_select(large, e + 1, e);
+        const T f{(m - 1) / (m + 1)};
+        const T f2{f * f};
+        const T ln_m{2 * f +
+                     2 * f * f2 * simd_polynomial<traits::ln_terms>::horner(coeffs::ln, f2)};
+        T y{e * traits::ln_2_hi + (ln_m + e * traits::ln_2_lo)};
+        y = simd_select(x < numeric_limits<T>::infinity(), y, x);
+        y = simd_select(x == 0, -numeric_limits<T>::infinity(), y);
+        return simd_select(x >= 0, y, numeric_limits<T>::quiet_NaN());
+      }
+
+      // square root of a positive normal number by Newton iterations for 1 / sqrt(x), used
+      // instead of sqrt, which may set errno and, therefore, prevents vectorization
+      template<typename T>
+      TRNG_SIMD_INLINE T simd_sqrt(T x) {
+        using traits = simd_math_traits<T>;
+        const T half_x{constants<T>::one_half * x};
+        T y{simd_from_bits<T>(traits::rsqrt_magic - (simd_to_bits(x) >> 1))};
+        for (int i{0}; i < 4; ++i)
+          y = y * (T(1.5) - half_x * y * y);
+        return x * y;
+      }
+
+      // erf(a) and erfc(a) for a >= 0, erf_a is accurate for a < 1/2 and erfc_a for
+      // a >= 1/2
+      template<typename T>
+      TRNG_SIMD_INLINE void simd_erf_erfc_abs(T a, T &erf_a, T &erfc_a) {
+        using traits = simd_math_traits<T>;
+        using coeffs = simd_math_coefficients<T>;
+        erf_a = a * simd_polynomial<traits::erf_terms>::horner(coeffs::erf, a * a);
+        // erfc(a) = exp(-a^2) h(1 / a) / a, erfc(a) is zero for a > 27.5
+        const T a_max{T(27.5)}, half{constants<T>::one_half};
+        T x{simd_select(a < a_max, a, a_max)};
+        x = simd_select(x > half, x, half);
+        const T t{1 / x};
+        // map t to u in [-1, 1]
+        const bool far{t < half};
+        const T t_far_min{T(2) / T(55)};
+        const T scale{simd_select(far, 2 / (half - t_far_min), T(4) / T(3))};
+        const T shift{simd_select(far, -(t_far_min + half) / (half - t_far_min), T(-5) / T(3))};
+        const T h{simd_blended_polynomial<traits::erfc_terms>::horner(
+            coeffs::erfc_far, coeffs::erfc_near, far, t * scale + shift)};
+        // -x^2 = -x_hi^2 - (x - x_hi) (x + x_hi) with x_hi^2 exact
+        const T x_hi{simd_from_bits<T>(simd_to_bits(x) & traits::split_mask)};
+        erfc_a = simd_exp(-x_hi * x_hi, -(x - x_hi) * (x + x_hi)) * h * t;
+      }
+
+      template<typename T>
+      TRNG_SIMD_INLINE T simd_erf(T x) {
+        const T a{simd_select(x < 0, -x, x)};
+        T erf_a, erfc_a;
+        simd_erf_erfc_abs(a, erf_a, erfc_a);
+        const T y{simd_select(a < constants<T>::one_half, erf_a, 1 - erfc_a)};
+        return simd_select(x < 0, -y, simd_select(x >= 0, y, x));
+      }
+
+      template<typename T>
+      TRNG_SIMD_INLINE T simd_erfc(T x) {
+        const T a{simd_select(x < 0, -x, x)};
+        T erf_a, erfc_a;
+        simd_erf_erfc_abs(a, erf_a, erfc_a);
+        const T y{simd_select(a < constants<T>::one_half, 1 - erf_a, erfc_a)};
+        return simd_select(x < 0, 2 - y, simd_select(x >= 0, y, x));
+      }
+
+      template<typename T>
+      TRNG_SIMD_INLINE T simd_Phi(T x) {
+        const T half{constants<T>::one_half};
+        const T z{x * constants<T>::one_over_sqrt_2};
+        const bool negative{z < 0};
+        const T a{simd_select(negative, -z, z)};
+        T erf_a, erfc_a;
+        simd_erf_erfc_abs(a, erf_a, erfc_a);
+        const T y_central{simd_select(negative, half - half * erf_a, half + half * erf_a)};
+        const T y_tail{simd_select(negative, half * erfc_a, 1 - half * erfc_a)};
+        return simd_select(x == x, simd_select(a < half, y_central, y_tail), x);
+      }
+
+      template<typename T>
+      TRNG_SIMD_INLINE T simd_inv_Phi(T x) {
+        using traits = inv_Phi_traits<T>;
+        const T half{traits::one_half};
+        // rational approximation for the central region
+        const T q{x - half};
+        const T r{q * q};
+        const T y_central{
+            (((((traits::a[0] * r + traits::a[1]) * r + traits::a[2]) * r + traits::a[3]) * r +
+              traits::a[4]) *
+                 r +
+             traits::a[5]) *
+            q /
+            (((((traits::b[0] * r + traits::b[1]) * r + traits::b[2]) * r + traits::b[3]) * r +
+              traits::b[4]) *
+                 r +
+             1)};
+        // rational approximation for the lower and upper region
+        const bool lower{x < half};
+        T p{simd_select(lower, x, 1 - x)};
+        p = simd_select(p > numeric_limits<T>::min(), p, numeric_limits<T>::min());
+        const T s{simd_sqrt(-2 * simd_ln(p))};
+        const T y_tail{
+            (((((traits::c[0] * s + traits::c[1]) * s + traits::c[2]) * s + traits::c[3]) * s +
+              traits::c[4]) *
+                 s +
+             traits::c[5]) /
+            ((((traits::d[0] * s + traits::d[1]) * s + traits::d[2]) * s + traits::d[3]) * s +
+             1)};
+        const bool above_low{x >= traits::x_low}, below_high{x < traits::x_high};
+        const bool central{above_low and below_high};
+        const T y0{simd_select(central, y_central, simd_select(lower, y_tail, -y_tail))};
+        // refinement by Halley rational method
+        const T e{simd_Phi(y0) - x};
+        const T u{e * constants<T>::sqrt_2pi * simd_exp(y0 * y0 * half)};
+        const T y1{y0 - u / (1 + y0 * u * half)};
+        T y{simd_select(y1 == y1, y1, y0)};
+        y = simd_select(x == 0, -numeric_limits<T>::infinity(), y);
+        y = simd_select(x == 1, numeric_limits<T>::infinity(), y);
+        const bool not_negative{x >= 0}, not_above_1{x <= 1};
+        return simd_select(not_negative and not_above_1, y, numeric_limits<T>::quiet_NaN());
+      }
+
+      // ---------------------------------------------------------------
+
+      template<typename T, T (*f)(T)>
+      inline void simd_transform(const T *first, const T *last, T *out) {
+        const std::ptrdiff_t n{last - first};
+        for (std::ptrdiff_t i{0}; i < n; ++i)
+          out[i] = f(first[i]);
+      }
+
+    }  // namespace detail
+
+    // --- logarithm ---------------------------------------------------
+
+    inline void ln(const float *first, const float *last, float *out) {
+      detail::simd_transform<float, detail::simd_ln<float>>(first, last, out);
+    }
+
+    inline void ln(const double *first, const double *last, double *out) {
+      detail::simd_transform<double, detail::simd_ln<double>>(first, last, out);
+    }
+
+    // --- exponential function ----------------------------------------
+
+    inline void exp(const float *first, const float *last, float *out) {
+      detail::simd_transform<float, detail::simd_exp<float>>(first, last, out);
+    }
+
+    inline void exp(const double *first, const double *last, double *out) {
+      detail::simd_transform<double, detail::simd_exp<double>>(first, last, out);
+    }
+
+    // --- error function and complementary error function--------------
+
+    inline void erf(const float *first, const float *last, float *out) {
+      detail::simd_transform<float, detail::simd_erf<float>>(first, last, out);
+    }
+
+    inline void erf(const double *first, const double *last, double *out) {
+      detail::simd_transform<double, detail::simd_erf<double>>(first, last, out);
+    }
+
+    inline void erfc(const float *first, const float *last, float *out) {
+      detail::simd_transform<float, detail::simd_erfc<float>>(first, last, out);
+    }
+
+    inline void erfc(const double *first, const double *last, double *out) {
+      detail::simd_transform<double, detail::simd_erfc<double>>(first, last, out);
+    }
+
+    // --- normal distribution function  -------------------------------
+
+    inline void Phi(const float *first, const float *last, float *out) {
+      detail::simd_transform<float, detail::simd_Phi<float>>(first, last, out);
+    }
+
+    inline void Phi(const double *first, const double *last, double *out) {
+      detail::simd_transform<double, detail::simd_Phi<double>>(first, last, out);
+    }
+
+    // --- inverse of normal distribution function  --------------------
+
+    inline void inv_Phi(const float *first, const float *last, float *out) {
+      detail::simd_transform<float, detail::simd_inv_Phi<float>>(first, last, out);
+    }
+
+    inline void inv_Phi(const double *first, const double *last, double *out) {
+      detail::simd_transform<double, detail::simd_inv_Phi<double>>(first, last, out);
+    }
+
+  }  // namespace math
+
+}  // namespace trng
+
+#endif
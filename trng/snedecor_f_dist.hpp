@@ -140,6 +140,12 @@ namespace trng {
       snedecor_f_dist g(P);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      utility::generate_transformed<utility::u01_interval::co, result_type>(
+          r, first, last, [this](result_type u) { return icdf_(u); });
+    }
     // property methods
     result_type min() const { return 0; }
     TRNG_CUDA_ENABLE
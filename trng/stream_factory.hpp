@@ -0,0 +1,177 @@
+// Copyright (c) 2000-2026, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_STREAM_FACTORY_HPP)
+
+#define TRNG_STREAM_FACTORY_HPP
+
+#include <trng/limits.hpp>
+#include <trng/utility.hpp>
+#include <trng/mrg_parameter.hpp>
+#include <trng/mrg_split_plan.hpp>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#if defined _MSC_VER && __cplusplus <= 201703
+#include <ciso646>
+#endif
+
+namespace trng {
+
+  // Partitioning of the sequence of a parallel random number engine into streams.  Stream i
+  // of a factory with block length b and s streams per block starts at position (i / s) * b
+  // of the base engine's sequence and takes every s-th number, i.e., it is a copy of the
+  // base engine advanced by jump((i / s) * b) and split via split(s, i % s).
+  //
+  //   block(R, b)            stream i starts at position i * b
+  //   leapfrog(R, s)         stream i < s takes every s-th number, starting at position i
+  //   hierarchical(R, b, s)  blocks of length b are shared by s leapfrogged streams
+  //
+  // Stream factories are immutable, their const member functions may be called concurrently
+  // from several threads.  Multiple recursive generators split via a precomputed
+  // mrg_split_plan, other engines via their split method.  Engines without a split method,
+  // e.g., mt19937 or lagfib2plus, support block partitioning only.
+  template<typename engine_t>
+  class stream_factory {
+    template<typename T>
+    struct void_type {
+      using type = void;
+    };
+
+    // engines with a split method
+    template<typename R, typename = void>
+    struct is_splittable : std::false_type {};
+
+    template<typename R>
+    struct is_splittable<
+        R, typename void_type<decltype(std::declval<R &>().split(0u, 0u))>::type>
+        : std::true_type {};
+
+    // parameter type of an engine, void if it has none
+    template<typename R, typename = void>
+    struct parameter_of {
+      using type = void;
+    };
+
+    template<typename R>
+    struct parameter_of<R, typename void_type<typename R::parameter_type>::type> {
+      using type = typename R::parameter_type;
+    };
+
+  public:
+    using engine_type = engine_t;
+
+    static stream_factory block(const engine_type &R, unsigned long long block_length) {
+      return stream_factory(R, block_length, 1);
+    }
+
+    static stream_factory leapfrog(const engine_type &R, unsigned int streams) {
+      static_assert(is_splittable<engine_type>::value, "engine must provide split method");
+      return stream_factory(R, 0, streams);
+    }
+
+    static stream_factory hierarchical(const engine_type &R, unsigned long long block_length,
+                                       unsigned int streams) {
+      static_assert(is_splittable<engine_type>::value, "engine must provide split method");
+      return stream_factory(R, block_length, streams);
+    }
+
+    unsigned long long block_length() const { return block_length_; }
+    unsigned int streams() const { return splitter.streams(); }
+
+    // engine for stream i
+    engine_type operator()(unsigned long long i) const {
+      const unsigned int s{splitter.streams()};
+      const unsigned long long block{i / s};
+      // leapfrog streams are limited in number, the start positions of blocks must not
+      // overflow, streams would overlap otherwise
+      if ((block_length_ == 0 and i >= s) or
+          (block_length_ > 0 and
+           block > math::numeric_limits<unsigned long long>::max() / block_length_))
+        utility::throw_this(
+            std::invalid_argument("invalid argument for trng::stream_factory::operator()"));
+      engine_type R_i(R);
+      if (block > 0)
+        R_i.jump(block * block_length_);
+      if (s > 1)
+        splitter.split(R_i, static_cast<unsigned int>(i % s));
+      return R_i;
+    }
+
+  private:
+    // split is called for more than one stream only
+    template<typename R, typename P = typename parameter_of<R>::type,
+             bool splittable = is_splittable<R>::value>
+    class leapfrog_splitter {
+    public:
+      leapfrog_splitter(const R &, unsigned int) {}
+      unsigned int streams() const { return 1; }
+      void split(R &, unsigned int) const {}
+    };
+
+    template<typename R, typename P>
+    class leapfrog_splitter<R, P, true> {
+      unsigned int s;
+
+    public:
+      leapfrog_splitter(const R &, unsigned int s) : s{s} {}
+      unsigned int streams() const { return s; }
+      void split(R &R_i, unsigned int n) const { R_i.split(s, n); }
+    };
+
+    template<typename R, typename T, int order>
+    class leapfrog_splitter<R, mrg_parameter<T, order, R>, true> {
+      unsigned int s;
+      std::shared_ptr<const mrg_split_plan<R>> plan;
+
+    public:
+      leapfrog_splitter(const R &R_0, unsigned int s)
+          : s{s}, plan(s > 1 ? new mrg_split_plan<R>(s, R_0) : nullptr) {}
+      unsigned int streams() const { return s; }
+      void split(R &R_i, unsigned int n) const { plan->split(R_i, n); }
+    };
+
+    engine_type R;
+    unsigned long long block_length_;
+    leapfrog_splitter<engine_type> splitter;
+
+    stream_factory(const engine_type &R, unsigned long long block_length, unsigned int streams)
+        : R(R), block_length_{block_length}, splitter(R, streams) {
+      if (streams < 1)
+        utility::throw_this(std::invalid_argument("invalid argument for trng::stream_factory"));
+    }
+  };
+
+}  // namespace trng
+
+#endif
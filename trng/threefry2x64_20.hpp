@@ -0,0 +1,381 @@
+// Copyright (c) 2000-2026, Heiko Bauke
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution
+//
+//   * Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#if !(defined TRNG_THREEFRY2X64_20_HPP)
+
+#define TRNG_THREEFRY2X64_20_HPP
+
+#include <trng/trng_export.hpp>
+#include <trng/cuda.hpp>
+#include <trng/limits.hpp>
+#include <trng/utility.hpp>
+#include <trng/int_types.hpp>
+#include <trng/uint128.hpp>
+#include <trng/generate_canonical.hpp>
+#include <climits>
+#include <stdexcept>
+#include <ostream>
+#include <istream>
+#if defined _MSC_VER && __cplusplus <= 201703
+#include <ciso646>
+#endif
+
+namespace trng {
+
+  // Counter-based random number generator Threefry2x64-20, see
+  //
+  // J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E. Shaw, ``Parallel random numbers: as
+  //   easy as 1, 2, 3'', Proceedings of 2011 International Conference for High Performance
+  //   Computing, Networking, Storage and Analysis, 2011.
+  //
+  // The i-th random number is word i mod 2 of the Threefry block of the 128-bit counter i / 2.
+  // The status is the position of the next random number, the parameters are the key and
+  // the distance between consecutive positions.  Thus, jumps and splits are O(1).
+  class threefry2x64_20 {
+  public:
+    // Uniform random number generator concept
+    using result_type = uint64_t;
+    TRNG_CUDA_ENABLE
+    result_type operator()();
+
+  private:
+    static constexpr result_type min_ = 0;
+    static constexpr result_type max_ = ~result_type(0);
+
+  public:
+    TRNG_CUDA_ENABLE
+    static constexpr result_type min() { return min_; }
+    TRNG_CUDA_ENABLE
+    static constexpr result_type max() { return max_; }
+
+  public:
+    // Parameter and status classes
+    class parameter_type {
+      result_type k0{0}, k1{0};
+      uint128 increment{1};
+
+    public:
+      parameter_type() = default;
+      explicit parameter_type(result_type k0, result_type k1) : k0{k0}, k1{k1} {}
+
+      friend class threefry2x64_20;
+
+      // Equality comparable concept
+      friend bool operator==(const parameter_type &, const parameter_type &);
+      friend bool operator!=(const parameter_type &, const parameter_type &);
+
+      // Streamable concept
+      template<typename char_t, typename traits_t>
+      friend std::basic_ostream<char_t, traits_t> &operator<<(
+          std::basic_ostream<char_t, traits_t> &out, const parameter_type &P) {
+        std::ios_base::fmtflags flags(out.flags());
+        out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        out << '(' << P.k0 << ' ' << P.k1 << ' ' << P.increment << ')';
+        out.flags(flags);
+        return out;
+      }
+
+      template<typename char_t, typename traits_t>
+      friend std::basic_istream<char_t, traits_t> &operator>>(
+          std::basic_istream<char_t, traits_t> &in, parameter_type &P) {
+        parameter_type P_new;
+        std::ios_base::fmtflags flags(in.flags());
+        in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        in >> utility::delim('(') >> P_new.k0 >> utility::delim(' ') >> P_new.k1 >>
+            utility::delim(' ') >> P_new.increment >> utility::delim(')');
+        if (in)
+          P = P_new;
+        in.flags(flags);
+        return in;
+      }
+    };
+
+    class status_type {
+      uint128 r{0};
+
+    public:
+      status_type() = default;
+      explicit status_type(uint128 r) : r{r} {}
+
+      friend class threefry2x64_20;
+
+      // Equality comparable concept
+      friend bool operator==(const status_type &, const status_type &);
+      friend bool operator!=(const status_type &, const status_type &);
+
+      // Streamable concept
+      template<typename char_t, typename traits_t>
+      friend std::basic_ostream<char_t, traits_t> &operator<<(
+          std::basic_ostream<char_t, traits_t> &out, const status_type &S) {
+        std::ios_base::fmtflags flags(out.flags());
+        out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        out << '(' << S.r << ')';
+        out.flags(flags);
+        return out;
+      }
+
+      template<typename char_t, typename traits_t>
+      friend std::basic_istream<char_t, traits_t> &operator>>(
+          std::basic_istream<char_t, traits_t> &in, status_type &S) {
+        status_type S_new;
+        std::ios_base::fmtflags flags(in.flags());
+        in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+        in >> utility::delim('(') >> S_new.r >> utility::delim(')');
+        if (in)
+          S = S_new;
+        in.flags(flags);
+        return in;
+      }
+    };
+
+    static TRNG4_EXPORT const parameter_type Default;
+
+    // Random number engine concept
+    explicit threefry2x64_20(parameter_type = Default);
+    explicit threefry2x64_20(unsigned long, parameter_type = Default);
+    explicit threefry2x64_20(unsigned long long, parameter_type = Default);
+
+    template<typename gen>
+    explicit threefry2x64_20(gen &g, parameter_type P = Default) : P{P} {
+      seed(g);
+    }
+
+    void seed();
+    void seed(unsigned long);
+    template<typename gen>
+    void seed(gen &g) {
+      uint128 r{0};
+      for (int i{0}; i < 4; ++i) {
+        r <<= 32;
+        r += uint128{static_cast<uint32_t>(g())};
+      }
+      S.r = r;
+    }
+    void seed(unsigned long long);
+
+    // Equality comparable concept
+    friend bool operator==(const threefry2x64_20 &, const threefry2x64_20 &);
+    friend bool operator!=(const threefry2x64_20 &, const threefry2x64_20 &);
+
+    // Streamable concept
+    template<typename char_t, typename traits_t>
+    friend std::basic_ostream<char_t, traits_t> &operator<<(
+        std::basic_ostream<char_t, traits_t> &out, const threefry2x64_20 &R) {
+      std::ios_base::fmtflags flags(out.flags());
+      out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+      out << '[' << threefry2x64_20::name() << ' ' << R.P << ' ' << R.S << ']';
+      out.flags(flags);
+      return out;
+    }
+
+    template<typename char_t, typename traits_t>
+    friend std::basic_istream<char_t, traits_t> &operator>>(
+        std::basic_istream<char_t, traits_t> &in, threefry2x64_20 &R) {
+      threefry2x64_20::parameter_type P_new;
+      threefry2x64_20::status_type S_new;
+      std::ios_base::fmtflags flags(in.flags());
+      in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+      in >> utility::ignore_spaces();
+      in >> utility::delim('[') >> utility::delim(threefry2x64_20::name()) >>
+          utility::delim(' ') >> P_new >> utility::delim(' ') >> S_new >> utility::delim(']');
+      if (in) {
+        R.P = P_new;
+        R.S = S_new;
+        R.block_valid = false;
+      }
+      in.flags(flags);
+      return in;
+    }
+
+    // Parallel random number generator concept
+    TRNG_CUDA_ENABLE
+    void split(unsigned int, unsigned int);
+    TRNG_CUDA_ENABLE
+    void jump2(unsigned int);
+    TRNG_CUDA_ENABLE
+    void jump(unsigned long long);
+    TRNG_CUDA_ENABLE
+    void discard(unsigned long long);
+
+    // Other useful methods
+    static const char *name();
+    TRNG_CUDA_ENABLE
+    long operator()(long);
+    template<typename iter>
+    TRNG_CUDA_ENABLE void generate(iter, iter);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
+    // random number that the (k + 1)-th call of operator() returns, state is not changed
+    TRNG_CUDA_ENABLE
+    result_type value_at(unsigned long long) const;
+    template<typename iter, typename out_iter>
+    TRNG_CUDA_ENABLE void values_at(iter, iter, out_iter) const;
+
+    // Threefry blocks of lanes consecutive counters c, c + 1, ..., word j of block l is x[j][l]
+    template<int lanes>
+    TRNG_CUDA_ENABLE static void blocks(result_type k0, result_type k1, uint128 c,
+                                        result_type (&x)[2][lanes]);
+
+  private:
+    parameter_type P;
+    status_type S;
+    static const char *const name_str;
+
+    // most recently computed block, not part of the engine's state
+    uint128 block_counter{0};
+    result_type block[2]{};
+    bool block_valid{false};
+
+    // number of blocks that generate computes at once
+    static constexpr int generate_lanes{4};
+  };
+
+  // Inline and template methods
+
+  template<int lanes>
+  TRNG_CUDA_ENABLE inline void threefry2x64_20::blocks(result_type k0, result_type k1,
+                                                       uint128 c, result_type (&x)[2][lanes]) {
+    const result_type ks[3]{k0, k1, 0x1bd11bdaa9fc1a22u ^ k0 ^ k1};
+    const unsigned int rot[8]{16, 42, 12, 31, 16, 32, 24, 21};
+    for (int l{0}; l < lanes; ++l) {
+      const uint128 c_l{c + uint128{static_cast<uint64_t>(l)}};
+      x[0][l] = c_l.lo() + ks[0];
+      x[1][l] = c_l.hi() + ks[1];
+    }
+    // the lane loop has no dependencies, compilers vectorize the additions and rotations
+    for (int round{0}; round < 20; ++round) {
+      const unsigned int r{rot[round % 8]};
+      for (int l{0}; l < lanes; ++l) {
+        x[0][l] += x[1][l];
+        x[1][l] = ((x[1][l] << r) | (x[1][l] >> (64u - r))) ^ x[0][l];
+      }
+      if (round % 4 == 3) {
+        const int s{round / 4 + 1};
+        for (int l{0}; l < lanes; ++l) {
+          x[0][l] += ks[s % 3];
+          x[1][l] += ks[(s + 1) % 3] + static_cast<result_type>(s);
+        }
+      }
+    }
+  }
+
+  TRNG_CUDA_ENABLE
+  inline threefry2x64_20::result_type threefry2x64_20::operator()() {
+    const uint128 c{S.r >> 1};
+    if (not block_valid or c != block_counter) {
+      result_type x[2][1];
+      blocks<1>(P.k0, P.k1, c, x);
+      for (int j{0}; j < 2; ++j)
+        block[j] = x[j][0];
+      block_counter = c;
+      block_valid = true;
+    }
+    const result_type t{block[S.r.lo() & 1u]};
+    S.r += P.increment;
+    return t;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline long threefry2x64_20::operator()(long x) {
+    return static_cast<long>(utility::uniformco<double, threefry2x64_20>(*this) * x);
+  }
+
+  template<typename iter>
+  TRNG_CUDA_ENABLE inline void threefry2x64_20::generate(iter first, iter last) {
+    if (P.increment != uint128{1}) {
+      for (; first != last; ++first)
+        *first = (*this)();
+      return;
+    }
+    // complete the current block, then compute several blocks at once
+    for (; first != last and (S.r.lo() & 1u) != 0; ++first)
+      *first = (*this)();
+    result_type x[2][generate_lanes];
+    while (first != last) {
+      blocks<generate_lanes>(P.k0, P.k1, S.r >> 1, x);
+      uint64_t n{0};
+      for (int l{0}; l < generate_lanes and first != last; ++l)
+        for (int j{0}; j < 2 and first != last; ++j, ++n, ++first)
+          *first = x[j][l];
+      S.r += uint128{n};
+    }
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void threefry2x64_20::generate(result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
+  TRNG_CUDA_ENABLE
+  inline threefry2x64_20::result_type threefry2x64_20::value_at(unsigned long long k) const {
+    const uint128 r{S.r + uint128{k} * P.increment};
+    result_type x[2][1];
+    blocks<1>(P.k0, P.k1, r >> 1, x);
+    return x[r.lo() & 1u][0];
+  }
+
+  template<typename iter, typename out_iter>
+  TRNG_CUDA_ENABLE inline void threefry2x64_20::values_at(iter first, iter last,
+                                                          out_iter out) const {
+    for (; first != last; ++first, ++out)
+      *out = value_at(*first);
+  }
+
+  // Parallel random number generator concept
+
+  TRNG_CUDA_ENABLE
+  inline void threefry2x64_20::split(unsigned int s, unsigned int n) {
+#if !(defined TRNG_CUDA)
+    if (s < 1 or n >= s)
+      utility::throw_this(
+          std::invalid_argument("invalid argument for trng::threefry2x64_20::split"));
+#endif
+    S.r += uint128{n} * P.increment;
+    P.increment *= uint128{s};
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void threefry2x64_20::jump2(unsigned int s) {
+    S.r += (uint128{1} << static_cast<int>(s % 128)) * P.increment;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void threefry2x64_20::jump(unsigned long long s) {
+    S.r += uint128{s} * P.increment;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void threefry2x64_20::discard(unsigned long long n) { jump(n); }
+
+}  // namespace trng
+
+#endif
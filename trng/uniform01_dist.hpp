@@ -109,6 +109,11 @@ namespace trng {
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &) {
       return utility::uniformco<result_type>(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      utility::uniformco<result_type>(r, first, last);
+    }
     // property methods
     // min / max
     TRNG_CUDA_ENABLE
@@ -39,6 +39,7 @@
 #include <trng/utility.hpp>
 #include <ostream>
 #include <istream>
+#include <type_traits>
 #if defined _MSC_VER && __cplusplus <= 201703
 #include <ciso646>
 #endif
@@ -50,6 +51,10 @@ namespace trng {
   public:
     using result_type = int;
 
+    // sampling methods, scaling a floating point number uniformly distributed in [0, 1) is
+    // the default
+    enum class method_type { floating_point, lemire };
+
     class param_type {
     private:
       result_type a_{0}, b_{1}, d_{1};
@@ -81,26 +86,89 @@ namespace trng {
 
   private:
     param_type P;
+    method_type M{method_type::floating_point};
+
+    // maps the output of an engine to integers uniformly distributed in [0, m), 64-bit
+    // outputs are reduced to their upper 32 bits, which are of better quality for linear
+    // congruential generators and sufficient for int results
+    template<typename R>
+    struct engine_range {
+      static constexpr unsigned long long span{
+          static_cast<unsigned long long>(R::max() - R::min())};
+      static constexpr bool full_64{span == ~0ull};
+      static constexpr bool integer{full_64 or span < (1ull << 32u)};
+      static constexpr unsigned long long m{full_64 ? (1ull << 32u) : span + 1};
+
+      TRNG_CUDA_ENABLE
+      static unsigned long long draw(R &r) {
+        const unsigned long long x{static_cast<unsigned long long>(r() - R::min())};
+        return full_64 ? x >> 32u : x;
+      }
+    };
+
+    template<typename R>
+    TRNG_CUDA_ENABLE result_type floating_point(R &r) const {
+      return static_cast<result_type>(P.d() * utility::uniformco<double>(r)) + P.a();
+    }
+
+    template<typename R>
+    TRNG_CUDA_ENABLE result_type lemire(R &r, std::false_type) const {
+      return floating_point(r);
+    }
+
+    // D. Lemire, ``Fast Random Integer Generation in an Interval''
+    // ACM Transactions on Modeling and Computer Simulation 29 (2019) 3,
+    // generalized to engines whose range m is not a power of two, division and modulo
+    // by the compile-time constant m reduce to multiplications and shifts
+    template<typename R>
+    TRNG_CUDA_ENABLE result_type lemire(R &r, std::true_type) const {
+      using range = engine_range<R>;
+      if (P.d() <= 0 or static_cast<unsigned long long>(P.d()) > range::m)
+        return floating_point(r);
+      const unsigned long long d{static_cast<unsigned long long>(P.d())};
+      unsigned long long l{range::draw(r) * d};
+      unsigned long long l_mod_m{l % range::m};
+      if (l_mod_m < d) {
+        // rejection threshold requires a true division, but is rarely needed
+        const unsigned long long t{range::m % d};
+        while (l_mod_m < t) {
+          l = range::draw(r) * d;
+          l_mod_m = l % range::m;
+        }
+      }
+      return static_cast<result_type>(l / range::m) + P.a();
+    }
 
   public:
     // constructor
     TRNG_CUDA_ENABLE
-    explicit uniform_int_dist(result_type a, result_type b) : P{a, b} {}
+    explicit uniform_int_dist(result_type a, result_type b,
+                              method_type M = method_type::floating_point)
+        : P{a, b}, M{M} {}
     TRNG_CUDA_ENABLE
-    explicit uniform_int_dist(const param_type &P) : P{P} {}
+    explicit uniform_int_dist(const param_type &P, method_type M = method_type::floating_point)
+        : P{P}, M{M} {}
     // reset internal state
     TRNG_CUDA_ENABLE
     void reset() {}
     // random numbers
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r) {
-      return static_cast<result_type>(P.d() * utility::uniformco<double>(r)) + P.a();
+      if (M == method_type::lemire)
+        return lemire(r, std::integral_constant<bool, engine_range<R>::integer>());
+      return floating_point(r);
     }
     template<typename R>
     TRNG_CUDA_ENABLE result_type operator()(R &r, const param_type &P) {
-      uniform_int_dist g(P);
+      uniform_int_dist g(P, M);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      for (; first != last; ++first)
+        *first = (*this)(r);
+    }
     // property methods
     TRNG_CUDA_ENABLE
     result_type min() const { return P.a(); }
@@ -111,6 +179,13 @@ namespace trng {
     TRNG_CUDA_ENABLE
     void param(const param_type &p_new) { P = p_new; }
     TRNG_CUDA_ENABLE
+    method_type method() const { return M; }
+    TRNG_CUDA_ENABLE
+    void method(method_type M_new) { M = M_new; }
+    // rejections of the Lemire method consume additional engine values
+    TRNG_CUDA_ENABLE
+    bool variable_draws() const { return M == method_type::lemire; }
+    TRNG_CUDA_ENABLE
     result_type a() const { return P.a(); }
     TRNG_CUDA_ENABLE
     void a(result_type a_new) { P.a(a_new); }
@@ -179,11 +254,11 @@ namespace trng {
   // EqualityComparable concept
   TRNG_CUDA_ENABLE
   inline bool operator==(const uniform_int_dist &g1, const uniform_int_dist &g2) {
-    return g1.param() == g2.param();
+    return g1.param() == g2.param() and g1.method() == g2.method();
   }
   TRNG_CUDA_ENABLE
   inline bool operator!=(const uniform_int_dist &g1, const uniform_int_dist &g2) {
-    return g1.param() != g2.param();
+    return not(g1 == g2);
   }
 
   // Streamable concept
@@ -192,7 +267,10 @@ namespace trng {
                                                    const uniform_int_dist &g) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    out << "[uniform_int " << g.param() << ']';
+    out << "[uniform_int " << g.param();
+    if (g.method() == uniform_int_dist::method_type::lemire)
+      out << " lemire";
+    out << ']';
     out.flags(flags);
     return out;
   }
@@ -201,12 +279,19 @@ namespace trng {
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
                                                    uniform_int_dist &g) {
     uniform_int_dist::param_type P;
+    uniform_int_dist::method_type m{uniform_int_dist::method_type::floating_point};
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    in >> utility::ignore_spaces() >> utility::delim("[uniform_int ") >> P >>
-        utility::delim(']');
-    if (in)
+    in >> utility::ignore_spaces() >> utility::delim("[uniform_int ") >> P;
+    if (in and in.peek() == ' ') {
+      in >> utility::delim(" lemire");
+      m = uniform_int_dist::method_type::lemire;
+    }
+    in >> utility::delim(']');
+    if (in) {
       g.param(P);
+      g.method(m);
+    }
     in.flags(flags);
     return in;
   }
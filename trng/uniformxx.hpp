@@ -36,8 +36,12 @@
 
 #include <trng/cuda.hpp>
 #include <trng/limits.hpp>
+#include <trng/int_types.hpp>
 #include <cstddef>
 #include <cfloat>
+#include <cstring>
+#include <type_traits>
+#include <iterator>
 #if defined _MSC_VER && __cplusplus <= 201703
 #include <ciso646>
 #endif
@@ -70,6 +74,45 @@ namespace trng {
 
     //------------------------------------------------------------------
 
+    // Conversion of mantissa bits into floating point numbers in [0, 1) by setting the
+    // exponent bits of 1, which gives a number in [1, 2), and subtracting 1.  This avoids
+    // integer to floating point conversions and normalization.
+    template<typename T>
+    struct ieee754_bits {
+      static constexpr bool available = false;
+      static constexpr unsigned int mantissa_bits = 0;
+    };
+
+    template<>
+    struct ieee754_bits<float> {
+      static constexpr bool available = math::numeric_limits<float>::is_iec559 and
+                                        math::numeric_limits<float>::digits == 24;
+      static constexpr unsigned int mantissa_bits = 23;
+      TRNG_CUDA_ENABLE
+      static float co(uint64_t x) {
+        const uint32_t b{static_cast<uint32_t>(x) | 0x3f800000u};
+        float y;
+        std::memcpy(&y, &b, sizeof(y));
+        return y - 1.0f;
+      }
+    };
+
+    template<>
+    struct ieee754_bits<double> {
+      static constexpr bool available = math::numeric_limits<double>::is_iec559 and
+                                        math::numeric_limits<double>::digits == 53;
+      static constexpr unsigned int mantissa_bits = 52;
+      TRNG_CUDA_ENABLE
+      static double co(uint64_t x) {
+        const uint64_t b{x | 0x3ff0000000000000u};
+        double y;
+        std::memcpy(&y, &b, sizeof(y));
+        return y - 1.0;
+      }
+    };
+
+    //------------------------------------------------------------------
+
     // With basic optimizations enabled, modern C++ compilers can reduce
     // all the public routines herein down to small inline code sequences.
     // They should also collapse the size (sizeof(u01xx_traits<...>) to 1.
@@ -106,6 +149,18 @@ namespace trng {
       static constexpr result_type domain_max =
           use_ll_of_shifted ? (domain_max0 >> 1u) : domain_max0;
 
+      // direct bit to floating point conversion if a single call gives enough full bits, it
+      // yields other numbers than the default conversion and is selected explicitly
+      static constexpr unsigned int mantissa_bits = ieee754_bits<ret_t>::mantissa_bits;
+      static constexpr bool bits_available =
+          ieee754_bits<ret_t>::available and calls_needed == 1 and
+          Holes<domain_max0>::result == 0 and domain_bits >= mantissa_bits and
+          bits <= mantissa_bits;
+      static constexpr unsigned int bits_shift =
+          bits_available ? domain_bits - mantissa_bits : 0;
+      using bits_available_type = std::integral_constant<bool, bits_available>;
+      static constexpr std::size_t chunk_size = 64;
+
       TRNG_CUDA_ENABLE
       static ret_t addin(prng_t &r) {
         const result_type x{r() - prng_t::min()};
@@ -156,6 +211,71 @@ namespace trng {
       TRNG_CUDA_ENABLE
       static ret_t oo_norm() { return cc_norm() * (ret_t(1) - 2 * eps()); }
 
+      TRNG_CUDA_ENABLE
+      static ret_t bits_to_co(result_type x) {
+        return ieee754_bits<ret_t>::co(static_cast<uint64_t>(x - prng_t::min()) >> bits_shift);
+      }
+      // half of the spacing of the numbers in [0, 1) that bits_to_co returns
+      TRNG_CUDA_ENABLE
+      static ret_t oo_bits_offset() {
+        return ret_t(1) / static_cast<ret_t>(2ull << mantissa_bits);
+      }
+
+      TRNG_CUDA_ENABLE
+      static ret_t co_bits(prng_t &r, std::true_type) { return bits_to_co(r()); }
+      TRNG_CUDA_ENABLE
+      static ret_t co_bits(prng_t &r, std::false_type) { return co(r); }
+      TRNG_CUDA_ENABLE
+      static ret_t oo_bits(prng_t &r, std::true_type) {
+        return bits_to_co(r()) + oo_bits_offset();
+      }
+      TRNG_CUDA_ENABLE
+      static ret_t oo_bits(prng_t &r, std::false_type) { return oo(r); }
+
+      // raw random numbers in bulk if the engine provides a generate method
+      template<typename R>
+      TRNG_CUDA_ENABLE static auto generate_raw(R &r, result_type *x, std::size_t n, int)
+          -> decltype(r.generate(x, n), void()) {
+        r.generate(x, n);
+      }
+      template<typename R>
+      TRNG_CUDA_ENABLE static void generate_raw(R &r, result_type *x, std::size_t n, long) {
+        for (std::size_t i{0}; i < n; ++i)
+          x[i] = r();
+      }
+
+      // numbers in [offset, 1 + offset) with direct bit to floating point conversion
+      template<typename iter>
+      TRNG_CUDA_ENABLE static void generate_bits(prng_t &r, iter first, iter last,
+                                                 ret_t offset) {
+        result_type x[chunk_size];
+        std::size_t n{static_cast<std::size_t>(std::distance(first, last))};
+        while (n > 0) {
+          const std::size_t m{n < chunk_size ? n : chunk_size};
+          n -= m;
+          generate_raw(r, x, m, 0);
+          for (std::size_t i{0}; i < m; ++i, ++first)
+            *first = bits_to_co(x[i]) + offset;
+        }
+      }
+
+      template<typename iter>
+      TRNG_CUDA_ENABLE static void co_bits(prng_t &r, iter first, iter last, std::true_type) {
+        generate_bits(r, first, last, ret_t(0));
+      }
+      template<typename iter>
+      TRNG_CUDA_ENABLE static void co_bits(prng_t &r, iter first, iter last, std::false_type) {
+        co(r, first, last);
+      }
+      template<typename iter>
+      TRNG_CUDA_ENABLE static void oo_bits(prng_t &r, iter first, iter last, std::true_type) {
+        generate_bits(r, first, last, oo_bits_offset());
+      }
+      template<typename iter>
+      TRNG_CUDA_ENABLE static void oo_bits(prng_t &r, iter first, iter last, std::false_type) {
+        oo(r, first, last);
+      }
+
     public:
       TRNG_CUDA_ENABLE
       static return_type cc(prng_t &r) {
@@ -168,6 +288,44 @@ namespace trng {
       static return_type oc(prng_t &r) { return ret_t(1) - co(r); }
       TRNG_CUDA_ENABLE
       static return_type oo(prng_t &r) { return variate(r) * oo_norm() + eps(); }
+
+      // direct bit to floating point conversion, numbers in [0, 1) lie on a grid of spacing
+      // 2^-52 (double) or 2^-23 (float), numbers in (0, 1) are shifted by half of the spacing,
+      // falls back to co and oo if the engine does not provide enough full bits per call
+      TRNG_CUDA_ENABLE
+      static return_type co_bits(prng_t &r) { return co_bits(r, bits_available_type()); }
+      TRNG_CUDA_ENABLE
+      static return_type oo_bits(prng_t &r) { return oo_bits(r, bits_available_type()); }
+
+      // ranges of random numbers
+      template<typename iter>
+      TRNG_CUDA_ENABLE static void cc(prng_t &r, iter first, iter last) {
+        for (; first != last; ++first)
+          *first = cc(r);
+      }
+      template<typename iter>
+      TRNG_CUDA_ENABLE static void co(prng_t &r, iter first, iter last) {
+        for (; first != last; ++first)
+          *first = co(r);
+      }
+      template<typename iter>
+      TRNG_CUDA_ENABLE static void oc(prng_t &r, iter first, iter last) {
+        for (; first != last; ++first)
+          *first = oc(r);
+      }
+      template<typename iter>
+      TRNG_CUDA_ENABLE static void oo(prng_t &r, iter first, iter last) {
+        for (; first != last; ++first)
+          *first = oo(r);
+      }
+      template<typename iter>
+      TRNG_CUDA_ENABLE static void co_bits(prng_t &r, iter first, iter last) {
+        co_bits(r, first, last, bits_available_type());
+      }
+      template<typename iter>
+      TRNG_CUDA_ENABLE static void oo_bits(prng_t &r, iter first, iter last) {
+        oo_bits(r, first, last, bits_available_type());
+      }
     };
 
     template<typename ReturnType, std::size_t bits, typename UniformRandomNumberGenerator>
@@ -195,6 +353,96 @@ namespace trng {
       return u01xx_traits<ReturnType, 1, PrngType>::oo(r);
     }
 
+    // direct bit to floating point conversion, yields other numbers than uniformco and
+    // uniformoo
+    template<typename ReturnType, typename PrngType>
+    TRNG_CUDA_ENABLE inline ReturnType uniformco_bits(PrngType &r) {
+      return u01xx_traits<ReturnType, 1, PrngType>::co_bits(r);
+    }
+
+    template<typename ReturnType, typename PrngType>
+    TRNG_CUDA_ENABLE inline ReturnType uniformoo_bits(PrngType &r) {
+      return u01xx_traits<ReturnType, 1, PrngType>::oo_bits(r);
+    }
+
+    template<typename ReturnType, typename PrngType, typename iter>
+    TRNG_CUDA_ENABLE inline void uniformcc(PrngType &r, iter first, iter last) {
+      u01xx_traits<ReturnType, 1, PrngType>::cc(r, first, last);
+    }
+
+    template<typename ReturnType, typename PrngType, typename iter>
+    TRNG_CUDA_ENABLE inline void uniformco(PrngType &r, iter first, iter last) {
+      u01xx_traits<ReturnType, 1, PrngType>::co(r, first, last);
+    }
+
+    template<typename ReturnType, typename PrngType, typename iter>
+    TRNG_CUDA_ENABLE inline void uniformoc(PrngType &r, iter first, iter last) {
+      u01xx_traits<ReturnType, 1, PrngType>::oc(r, first, last);
+    }
+
+    template<typename ReturnType, typename PrngType, typename iter>
+    TRNG_CUDA_ENABLE inline void uniformoo(PrngType &r, iter first, iter last) {
+      u01xx_traits<ReturnType, 1, PrngType>::oo(r, first, last);
+    }
+
+    template<typename ReturnType, typename PrngType, typename iter>
+    TRNG_CUDA_ENABLE inline void uniformco_bits(PrngType &r, iter first, iter last) {
+      u01xx_traits<ReturnType, 1, PrngType>::co_bits(r, first, last);
+    }
+
+    template<typename ReturnType, typename PrngType, typename iter>
+    TRNG_CUDA_ENABLE inline void uniformoo_bits(PrngType &r, iter first, iter last) {
+      u01xx_traits<ReturnType, 1, PrngType>::oo_bits(r, first, last);
+    }
+
+    //------------------------------------------------------------------
+
+    // intervals of uniform random numbers, co_bits and oo_bits select the direct bit to
+    // floating point conversion
+    enum class u01_interval { cc, co, oc, oo, co_bits, oo_bits };
+
+    template<u01_interval interval, typename ReturnType, typename PrngType, typename iter>
+    inline void uniformxx(PrngType &r, iter first, iter last) {
+      switch (interval) {
+        case u01_interval::cc:
+          uniformcc<ReturnType>(r, first, last);
+          break;
+        case u01_interval::co:
+          uniformco<ReturnType>(r, first, last);
+          break;
+        case u01_interval::oc:
+          uniformoc<ReturnType>(r, first, last);
+          break;
+        case u01_interval::oo:
+          uniformoo<ReturnType>(r, first, last);
+          break;
+        case u01_interval::co_bits:
+          uniformco_bits<ReturnType>(r, first, last);
+          break;
+        case u01_interval::oo_bits:
+          uniformoo_bits<ReturnType>(r, first, last);
+          break;
+      }
+    }
+
+    // Fills a range with f(u), where u are uniform random numbers from the given interval.
+    // Uniform random numbers are drawn in chunks and transformed in a separate loop, which
+    // the compiler may vectorize.  The results equal f applied to single random numbers.
+    template<u01_interval interval, typename ReturnType, typename PrngType, typename iter,
+             typename function>
+    inline void generate_transformed(PrngType &r, iter first, iter last, function f) {
+      const std::size_t chunk_size{64};
+      ReturnType u[chunk_size];
+      std::size_t n{static_cast<std::size_t>(std::distance(first, last))};
+      while (n > 0) {
+        const std::size_t m{n < chunk_size ? n : chunk_size};
+        n -= m;
+        uniformxx<interval, ReturnType>(r, u, u + m);
+        for (std::size_t i{0}; i < m; ++i, ++first)
+          *first = f(u[i]);
+      }
+    }
+
   }  // namespace utility
 
 }  // namespace trng
@@ -134,6 +134,14 @@ namespace trng {
       weibull_dist g(P);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      utility::generate_transformed<utility::u01_interval::oc, result_type>(
+          r, first, last, [this](result_type u) {
+            return P.theta() * math::pow(-math::ln(u), 1 / P.beta());
+          });
+    }
     // property methods
     TRNG_CUDA_ENABLE
     result_type min() const { return 0; }
@@ -208,6 +208,10 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    template<typename iter>
+    TRNG_CUDA_ENABLE void generate(iter, iter);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
 
   private:
     status_type S;
@@ -241,6 +245,30 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, xoshiro256plus>(*this) * x);
   }
 
+  template<typename iter>
+  TRNG_CUDA_ENABLE inline void xoshiro256plus::generate(iter first, iter last) {
+    result_type r0{S.r[0]}, r1{S.r[1]}, r2{S.r[2]}, r3{S.r[3]};
+    for (; first != last; ++first) {
+      const result_type t{r1 << 17};
+      r2 ^= r0;
+      r3 ^= r1;
+      r1 ^= r2;
+      r0 ^= r3;
+      r2 ^= t;
+      r3 = (r3 << 45) | (r3 >> (64 - 45));
+      *first = r0 + r3;
+    }
+    S.r[0] = r0;
+    S.r[1] = r1;
+    S.r[2] = r2;
+    S.r[3] = r3;
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void xoshiro256plus::generate(result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
   // Parallel random number generator concept
 
   TRNG_CUDA_ENABLE
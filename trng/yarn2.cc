@@ -75,6 +75,6 @@ namespace trng {
 
   const char *yarn2::name() { return name_str; }
 
-  const int_math::power<yarn2::modulus, yarn2::gen> yarn2::g;
+  const int_math::power_lazy<yarn2::modulus, yarn2::gen> yarn2::g;
 
 }  // namespace trng
@@ -81,6 +81,6 @@ namespace trng {
 
   const char *yarn3::name() { return name_str; }
 
-  const int_math::power<yarn3::modulus, yarn3::gen> yarn3::g;
+  const int_math::power_lazy<yarn3::modulus, yarn3::gen> yarn3::g;
 
 }  // namespace trng
@@ -80,6 +80,6 @@ namespace trng {
 
   const char *yarn3s::name() { return name_str; }
 
-  const int_math::power<yarn3s::modulus, yarn3s::gen> yarn3s::g;
+  const int_math::power_lazy<yarn3s::modulus, yarn3s::gen> yarn3s::g;
 
 }  // namespace trng
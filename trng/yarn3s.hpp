@@ -41,6 +41,7 @@
 #include <trng/int_math.hpp>
 #include <trng/mrg_parameter.hpp>
 #include <trng/mrg_status.hpp>
+#include <trng/mrg_jump_table.hpp>
 #include <ostream>
 #include <istream>
 #include <stdexcept>
@@ -62,7 +63,7 @@ namespace trng {
     static constexpr result_type gen = 1616076847;
     static constexpr result_type min_ = 0;
     static constexpr result_type max_ = modulus - 1;
-    static TRNG4_EXPORT const int_math::power<yarn3s::modulus, yarn3s::gen> g;
+    static TRNG4_EXPORT const int_math::power_lazy<yarn3s::modulus, yarn3s::gen> g;
 
   public:
     TRNG_CUDA_ENABLE
@@ -145,12 +146,23 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    template<typename iter>
+    TRNG_CUDA_ENABLE void generate(iter, iter);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
 
   private:
     parameter_type P;
     status_type S;
     static const char *const name_str;
 
+    using jump_table = mrg_jump_table<3, modulus>;
+
+    template<typename, int>
+    friend class simd_lanes;
+    template<typename>
+    friend class mrg_split_plan;
+
     TRNG_CUDA_ENABLE
     void backward();
     TRNG_CUDA_ENABLE
@@ -194,6 +206,34 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, yarn3s>(*this) * x);
   }
 
+  template<typename iter>
+  TRNG_CUDA_ENABLE inline void yarn3s::generate(iter first, iter last) {
+#if defined TRNG_CUDA
+    for (; first != last; ++first)
+      *first = (*this)();
+#else
+    const uint64_t a0{static_cast<uint64_t>(P.a[0])}, a1{static_cast<uint64_t>(P.a[1])},
+        a2{static_cast<uint64_t>(P.a[2])};
+    result_type r0{S.r[0]}, r1{S.r[1]}, r2{S.r[2]};
+    for (; first != last; ++first) {
+      const uint64_t t{a0 * static_cast<uint64_t>(r0) + a1 * static_cast<uint64_t>(r1) +
+                       a2 * static_cast<uint64_t>(r2)};
+      r2 = r1;
+      r1 = r0;
+      r0 = int_math::modulo<modulus, 3>(t);
+      *first = r0 == 0 ? 0 : g(r0);
+    }
+    S.r[0] = r0;
+    S.r[1] = r1;
+    S.r[2] = r2;
+#endif
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void yarn3s::generate(result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
   // Parallel random number generator concept
   TRNG_CUDA_ENABLE
   inline void yarn3s::split(unsigned int s, unsigned int n) {
@@ -227,7 +267,7 @@ namespace trng {
       b[6] = q4;
       b[7] = q3;
       b[8] = q2;
-      int_math::gauss<3>(b, a, modulus);
+      int_math::gauss<3, modulus>(b, a);
       P.a[0] = a[0];
       P.a[1] = a[1];
       P.a[2] = a[2];
@@ -241,6 +281,12 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void yarn3s::jump2(unsigned int s) {
+#if !(defined TRNG_CUDA)
+    if (s < jump_table::levels) {
+      jump_table::jump2(P.a, S.r, s);
+      return;
+    }
+#endif
     result_type b[9], c[9]{};
     b[0] = P.a[0];
     b[1] = P.a[1];
@@ -252,18 +298,18 @@ namespace trng {
     b[7] = 1;
     b[8] = 0;
     for (unsigned int i{0}; i < s; ++i) {
-      int_math::matrix_mult<3>(b, b, c, modulus);
+      int_math::matrix_mult<3, modulus>(b, b, c);
       ++i;
       if (not(i < s))
         break;
-      int_math::matrix_mult<3>(c, c, b, modulus);
+      int_math::matrix_mult<3, modulus>(c, c, b);
     }
     const result_type r[3]{S.r[0], S.r[1], S.r[2]};
     result_type d[3];
     if ((s & 1u) == 0)
-      int_math::matrix_vec_mult<3>(b, r, d, modulus);
+      int_math::matrix_vec_mult<3, modulus>(b, r, d);
     else
-      int_math::matrix_vec_mult<3>(c, r, d, modulus);
+      int_math::matrix_vec_mult<3, modulus>(c, r, d);
     S.r[0] = d[0];
     S.r[1] = d[1];
     S.r[2] = d[2];
@@ -275,6 +321,7 @@ namespace trng {
       for (unsigned int i{0}; i < s; ++i)
         step();
     } else {
+#if defined TRNG_CUDA
       unsigned int i(0);
       while (s > 0) {
         if (s % 2 == 1)
@@ -282,6 +329,9 @@ namespace trng {
         ++i;
         s >>= 1u;
       }
+#else
+      jump_table::jump(P.a, S.r, s);
+#endif
     }
   }
 
@@ -85,6 +85,6 @@ namespace trng {
 
   const char *yarn4::name() { return name_str; }
 
-  const int_math::power<yarn4::modulus, yarn4::gen> yarn4::g;
+  const int_math::power_lazy<yarn4::modulus, yarn4::gen> yarn4::g;
 
 }  // namespace trng
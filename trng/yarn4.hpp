@@ -41,6 +41,7 @@
 #include <trng/int_math.hpp>
 #include <trng/mrg_parameter.hpp>
 #include <trng/mrg_status.hpp>
+#include <trng/mrg_jump_table.hpp>
 #include <ostream>
 #include <istream>
 #include <stdexcept>
@@ -62,7 +63,7 @@ namespace trng {
     static constexpr result_type gen = 123567893;
     static constexpr result_type min_ = 0;
     static constexpr result_type max_ = modulus - 1;
-    static TRNG4_EXPORT const int_math::power<yarn4::modulus, yarn4::gen> g;
+    static TRNG4_EXPORT const int_math::power_lazy<yarn4::modulus, yarn4::gen> g;
 
   public:
     TRNG_CUDA_ENABLE
@@ -147,12 +148,23 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    template<typename iter>
+    TRNG_CUDA_ENABLE void generate(iter, iter);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
 
   private:
     parameter_type P;
     status_type S;
     static const char *const name_str;
 
+    using jump_table = mrg_jump_table<4, modulus>;
+
+    template<typename, int>
+    friend class simd_lanes;
+    template<typename>
+    friend class mrg_split_plan;
+
     TRNG_CUDA_ENABLE
     void backward();
     TRNG_CUDA_ENABLE
@@ -198,6 +210,36 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, yarn4>(*this) * x);
   }
 
+  template<typename iter>
+  TRNG_CUDA_ENABLE inline void yarn4::generate(iter first, iter last) {
+#if defined TRNG_CUDA
+    for (; first != last; ++first)
+      *first = (*this)();
+#else
+    const uint64_t a0{static_cast<uint64_t>(P.a[0])}, a1{static_cast<uint64_t>(P.a[1])},
+        a2{static_cast<uint64_t>(P.a[2])}, a3{static_cast<uint64_t>(P.a[3])};
+    result_type r0{S.r[0]}, r1{S.r[1]}, r2{S.r[2]}, r3{S.r[3]};
+    for (; first != last; ++first) {
+      const uint64_t t{a0 * static_cast<uint64_t>(r0) + a1 * static_cast<uint64_t>(r1) +
+                       a2 * static_cast<uint64_t>(r2) + a3 * static_cast<uint64_t>(r3)};
+      r3 = r2;
+      r2 = r1;
+      r1 = r0;
+      r0 = int_math::modulo<modulus, 4>(t);
+      *first = r0 == 0 ? 0 : g(r0);
+    }
+    S.r[0] = r0;
+    S.r[1] = r1;
+    S.r[2] = r2;
+    S.r[3] = r3;
+#endif
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void yarn4::generate(result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
   // Parallel random number generator concept
   TRNG_CUDA_ENABLE
   inline void yarn4::split(unsigned int s, unsigned int n) {
@@ -243,7 +285,7 @@ namespace trng {
       b[13] = q5;
       b[14] = q4;
       b[15] = q3;
-      int_math::gauss<4>(b, a, modulus);
+      int_math::gauss<4, modulus>(b, a);
       P.a[0] = a[0];
       P.a[1] = a[1];
       P.a[2] = a[2];
@@ -259,6 +301,12 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void yarn4::jump2(unsigned int s) {
+#if !(defined TRNG_CUDA)
+    if (s < jump_table::levels) {
+      jump_table::jump2(P.a, S.r, s);
+      return;
+    }
+#endif
     result_type b[16], c[16]{};
     b[0] = P.a[0];
     b[1] = P.a[1];
@@ -277,18 +325,18 @@ namespace trng {
     b[14] = 1;
     b[15] = 0;
     for (unsigned int i{0}; i < s; ++i) {
-      int_math::matrix_mult<4>(b, b, c, modulus);
+      int_math::matrix_mult<4, modulus>(b, b, c);
       ++i;
       if (not(i < s))
         break;
-      int_math::matrix_mult<4>(c, c, b, modulus);
+      int_math::matrix_mult<4, modulus>(c, c, b);
     }
     const result_type r[4]{S.r[0], S.r[1], S.r[2], S.r[3]};
     result_type d[4];
     if ((s & 1u) == 0)
-      int_math::matrix_vec_mult<4>(b, r, d, modulus);
+      int_math::matrix_vec_mult<4, modulus>(b, r, d);
     else
-      int_math::matrix_vec_mult<4>(c, r, d, modulus);
+      int_math::matrix_vec_mult<4, modulus>(c, r, d);
     S.r[0] = d[0];
     S.r[1] = d[1];
     S.r[2] = d[2];
@@ -301,6 +349,7 @@ namespace trng {
       for (unsigned int i{0}; i < s; ++i)
         step();
     } else {
+#if defined TRNG_CUDA
       unsigned int i{0};
       while (s > 0) {
         if (s % 2 == 1)
@@ -308,6 +357,9 @@ namespace trng {
         ++i;
         s >>= 1;
       }
+#else
+      jump_table::jump(P.a, S.r, s);
+#endif
     }
   }
 
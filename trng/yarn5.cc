@@ -87,6 +87,6 @@ namespace trng {
 
   const char *yarn5::name() { return name_str; }
 
-  const int_math::power<yarn5::modulus, yarn5::gen> yarn5::g;
+  const int_math::power_lazy<yarn5::modulus, yarn5::gen> yarn5::g;
 
 }  // namespace trng
@@ -41,6 +41,7 @@
 #include <trng/int_math.hpp>
 #include <trng/mrg_parameter.hpp>
 #include <trng/mrg_status.hpp>
+#include <trng/mrg_jump_table.hpp>
 #include <ostream>
 #include <istream>
 #include <stdexcept>
@@ -62,7 +63,7 @@ namespace trng {
     static constexpr result_type gen = 123567893;
     static constexpr result_type min_ = 0;
     static constexpr result_type max_ = modulus - 1;
-    static TRNG4_EXPORT const int_math::power<yarn5::modulus, yarn5::gen> g;
+    static TRNG4_EXPORT const int_math::power_lazy<yarn5::modulus, yarn5::gen> g;
 
   public:
     TRNG_CUDA_ENABLE
@@ -148,12 +149,23 @@ namespace trng {
     static const char *name();
     TRNG_CUDA_ENABLE
     long operator()(long);
+    template<typename iter>
+    TRNG_CUDA_ENABLE void generate(iter, iter);
+    TRNG_CUDA_ENABLE
+    void generate(result_type *, std::size_t);
 
   private:
     parameter_type P;
     status_type S;
     static const char *const name_str;
 
+    using jump_table = mrg_jump_table<5, modulus>;
+
+    template<typename, int>
+    friend class simd_lanes;
+    template<typename>
+    friend class mrg_split_plan;
+
     TRNG_CUDA_ENABLE
     void backward();
     TRNG_CUDA_ENABLE
@@ -203,6 +215,42 @@ namespace trng {
     return static_cast<long>(utility::uniformco<double, yarn5>(*this) * x);
   }
 
+  template<typename iter>
+  TRNG_CUDA_ENABLE inline void yarn5::generate(iter first, iter last) {
+#if defined TRNG_CUDA
+    for (; first != last; ++first)
+      *first = (*this)();
+#else
+    const uint64_t a0{static_cast<uint64_t>(P.a[0])}, a1{static_cast<uint64_t>(P.a[1])},
+        a2{static_cast<uint64_t>(P.a[2])}, a3{static_cast<uint64_t>(P.a[3])},
+        a4{static_cast<uint64_t>(P.a[4])};
+    result_type r0{S.r[0]}, r1{S.r[1]}, r2{S.r[2]}, r3{S.r[3]}, r4{S.r[4]};
+    for (; first != last; ++first) {
+      uint64_t t{a0 * static_cast<uint64_t>(r0) + a1 * static_cast<uint64_t>(r1) +
+                 a2 * static_cast<uint64_t>(r2) + a3 * static_cast<uint64_t>(r3)};
+      if (t >= static_cast<uint64_t>(2u) * modulus * modulus)
+        t -= static_cast<uint64_t>(2u) * modulus * modulus;
+      t += a4 * static_cast<uint64_t>(r4);
+      r4 = r3;
+      r3 = r2;
+      r2 = r1;
+      r1 = r0;
+      r0 = int_math::modulo<modulus, 5>(t);
+      *first = r0 == 0 ? 0 : g(r0);
+    }
+    S.r[0] = r0;
+    S.r[1] = r1;
+    S.r[2] = r2;
+    S.r[3] = r3;
+    S.r[4] = r4;
+#endif
+  }
+
+  TRNG_CUDA_ENABLE
+  inline void yarn5::generate(result_type *first, std::size_t n) {
+    generate(first, first + n);
+  }
+
   // Parallel random number generator concept
   TRNG_CUDA_ENABLE
   inline void yarn5::split(unsigned int s, unsigned int n) {
@@ -262,7 +310,7 @@ namespace trng {
       b[22] = q6;
       b[23] = q5;
       b[24] = q4;
-      int_math::gauss<5>(b, a, modulus);
+      int_math::gauss<5, modulus>(b, a);
       P.a[0] = a[0];
       P.a[1] = a[1];
       P.a[2] = a[2];
@@ -280,6 +328,12 @@ namespace trng {
 
   TRNG_CUDA_ENABLE
   inline void yarn5::jump2(unsigned int s) {
+#if !(defined TRNG_CUDA)
+    if (s < jump_table::levels) {
+      jump_table::jump2(P.a, S.r, s);
+      return;
+    }
+#endif
     result_type b[25], c[25]{};
     b[0] = P.a[0];
     b[1] = P.a[1];
@@ -307,18 +361,18 @@ namespace trng {
     b[23] = 1;
     b[24] = 0;
     for (unsigned int i{0}; i < s; ++i) {
-      int_math::matrix_mult<5>(b, b, c, modulus);
+      int_math::matrix_mult<5, modulus>(b, b, c);
       ++i;
       if (not(i < s))
         break;
-      int_math::matrix_mult<5>(c, c, b, modulus);
+      int_math::matrix_mult<5, modulus>(c, c, b);
     }
     const result_type r[5]{S.r[0], S.r[1], S.r[2], S.r[3], S.r[4]};
     result_type d[5];
     if ((s & 1u) == 0)
-      int_math::matrix_vec_mult<5>(b, r, d, modulus);
+      int_math::matrix_vec_mult<5, modulus>(b, r, d);
     else
-      int_math::matrix_vec_mult<5>(c, r, d, modulus);
+      int_math::matrix_vec_mult<5, modulus>(c, r, d);
     S.r[0] = d[0];
     S.r[1] = d[1];
     S.r[2] = d[2];
@@ -332,6 +386,7 @@ namespace trng {
       for (unsigned int i(0); i < s; ++i)
         step();
     } else {
+#if defined TRNG_CUDA
       unsigned int i(0);
       while (s > 0) {
         if (s % 2 == 1)
@@ -339,6 +394,9 @@ namespace trng {
         ++i;
         s >>= 1u;
       }
+#else
+      jump_table::jump(P.a, S.r, s);
+#endif
     }
   }
 
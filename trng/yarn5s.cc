@@ -90,6 +90,6 @@ namespace trng {
 
   const char *yarn5s::name() { return name_str; }
 
-  const int_math::power<yarn5s::modulus, yarn5s::gen> yarn5s::g;
+  const int_math::power_lazy<yarn5s::modulus, yarn5s::gen> yarn5s::g;
 
 }  // namespace trng
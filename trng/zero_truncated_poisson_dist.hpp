@@ -38,6 +38,7 @@
 #include <trng/utility.hpp>
 #include <trng/math.hpp>
 #include <trng/special_functions.hpp>
+#include <trng/poisson_dist.hpp>
 #include <ostream>
 #include <istream>
 #include <iomanip>
@@ -53,13 +54,28 @@ namespace trng {
   public:
     using result_type = int;
 
+    // sampling methods, inversion of the cumulative density function is the default
+    using method_type = poisson_dist::method_type;
+
     class param_type {
     private:
       double mu_{0};
+      method_type M_{method_type::inversion};
       std::vector<double> P_;
+      // parameters of the untruncated distribution for the PTRS method
+      poisson_dist::param_type poisson_;
+
+      bool ptrs() const {
+        return M_ == method_type::ptrs and mu_ >= poisson_dist::ptrs_mu_min;
+      }
 
       void calc_probabilities() {
         P_ = std::vector<double>();
+        if (ptrs()) {
+          poisson_ = poisson_dist::param_type(mu_, M_);
+          return;
+        }
+        poisson_ = poisson_dist::param_type();
         int x{1};
         P_.push_back(0);
         while (x < 7 or x < 2 * mu_) {
@@ -76,8 +92,15 @@ namespace trng {
         mu_ = mu_new;
         calc_probabilities();
       }
+      method_type method() const { return M_; }
+      void method(method_type M_new) {
+        M_ = M_new;
+        calc_probabilities();
+      }
       param_type() = default;
-      explicit param_type(double mu) : mu_{mu} { calc_probabilities(); }
+      explicit param_type(double mu, method_type M = method_type::inversion) : mu_{mu}, M_{M} {
+        calc_probabilities();
+      }
       friend class zero_truncated_poisson_dist;
     };
 
@@ -86,13 +109,23 @@ namespace trng {
 
   public:
     // constructor
-    explicit zero_truncated_poisson_dist(double mu) : P{mu} {}
+    explicit zero_truncated_poisson_dist(double mu, method_type M = method_type::inversion)
+        : P{mu, M} {}
     explicit zero_truncated_poisson_dist(const param_type &P) : P{P} {}
     // reset internal state
     void reset() {}
     // random numbers
     template<typename R>
     int operator()(R &r) {
+      if (P.ptrs()) {
+        // zeros are rare for large mu and simply rejected
+        poisson_dist g(P.poisson_);
+        int x;
+        do {
+          x = g(r);
+        } while (x == 0);
+        return x;
+      }
       double p{utility::uniformco<double>(r)};
       const std::size_t x{utility::discrete(p, P.P_.begin(), P.P_.end())};
       int x_i{static_cast<int>(x)};
@@ -110,11 +143,21 @@ namespace trng {
       zero_truncated_poisson_dist g(p);
       return g(r);
     }
+    // ranges of random numbers
+    template<typename R, typename iter>
+    void generate(R &r, iter first, iter last) {
+      for (; first != last; ++first)
+        *first = (*this)(r);
+    }
     // property methods
     int min() const { return 1; }
     int max() const { return math::numeric_limits<int>::max(); }
     const param_type &param() const { return P; }
     void param(const param_type &P_new) { P = P_new; }
+    method_type method() const { return P.method(); }
+    void method(method_type M_new) { P.method(M_new); }
+    // rejections of zeros and of the PTRS method consume additional engine values
+    bool variable_draws() const { return P.ptrs(); }
     double mu() const { return P.mu(); }
     void mu(double mu_new) { P.mu(mu_new); }
     // probability density function
@@ -136,7 +179,7 @@ namespace trng {
   // EqualityComparable concept
   inline bool operator==(const zero_truncated_poisson_dist::param_type &P1,
                          const zero_truncated_poisson_dist::param_type &P2) {
-    return P1.mu() == P2.mu();
+    return P1.mu() == P2.mu() and P1.method() == P2.method();
   }
   inline bool operator!=(const zero_truncated_poisson_dist::param_type &P1,
                          const zero_truncated_poisson_dist::param_type &P2) {
@@ -150,8 +193,10 @@ namespace trng {
       const zero_truncated_poisson_dist::param_type &P) {
     std::ios_base::fmtflags flags(out.flags());
     out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    out << '(' << std::setprecision(math::numeric_limits<double>::digits10 + 1) << P.mu()
-        << ')';
+    out << '(' << std::setprecision(math::numeric_limits<double>::digits10 + 1) << P.mu();
+    if (P.method() == zero_truncated_poisson_dist::method_type::ptrs)
+      out << " ptrs";
+    out << ')';
     out.flags(flags);
     return out;
   }
@@ -160,11 +205,18 @@ namespace trng {
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
                                                    zero_truncated_poisson_dist::param_type &P) {
     double mu;
+    zero_truncated_poisson_dist::method_type m{
+        zero_truncated_poisson_dist::method_type::inversion};
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    in >> utility::delim('(') >> mu >> utility::delim(')');
+    in >> utility::delim('(') >> mu;
+    if (in and in.peek() == ' ') {
+      in >> utility::delim(" ptrs");
+      m = zero_truncated_poisson_dist::method_type::ptrs;
+    }
+    in >> utility::delim(')');
     if (in)
-      P = zero_truncated_poisson_dist::param_type(mu);
+      P = zero_truncated_poisson_dist::param_type(mu, m);
     in.flags(flags);
     return in;
   }
@@ -178,7 +230,7 @@ namespace trng {
   }
   inline bool operator!=(const zero_truncated_poisson_dist &g1,
                          const zero_truncated_poisson_dist &g2) {
-    return g1.param() != g2.param();
+    return not(g1 == g2);
   }
 
   // Streamable concept
@@ -195,13 +247,21 @@ namespace trng {
   template<typename char_t, typename traits_t>
   std::basic_istream<char_t, traits_t> &operator>>(std::basic_istream<char_t, traits_t> &in,
                                                    zero_truncated_poisson_dist &g) {
-    zero_truncated_poisson_dist::param_type P;
+    double mu;
+    zero_truncated_poisson_dist::method_type m{
+        zero_truncated_poisson_dist::method_type::inversion};
     std::ios_base::fmtflags flags(in.flags());
     in.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
-    in >> utility::ignore_spaces() >> utility::delim("[zero-truncated poisson ") >> P >>
-        utility::delim(']');
+    // parameters are read directly to avoid building the inversion table needlessly
+    in >> utility::ignore_spaces() >> utility::delim("[zero-truncated poisson ") >>
+        utility::delim('(') >> mu;
+    if (in and in.peek() == ' ') {
+      in >> utility::delim(" ptrs");
+      m = zero_truncated_poisson_dist::method_type::ptrs;
+    }
+    in >> utility::delim(")]");
     if (in)
-      g.param(P);
+      g.param(zero_truncated_poisson_dist::param_type(mu, m));
     in.flags(flags);
     return in;
   }